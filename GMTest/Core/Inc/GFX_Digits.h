@@ -0,0 +1,26 @@
+/*
+ * GFX_Digits.h
+ *
+ *  Generated by Tools/gen_digits.py - do not edit by hand.
+ */
+
+#ifndef INC_GFX_DIGITS_H_
+#define INC_GFX_DIGITS_H_
+
+#include <stdint.h>
+
+/* Large '0'-'9' glyphs for the numeric readout. Each glyph is w*h 4-bit
+ * coverage values (0 = background, 15 = foreground), row-major, two pixels
+ * per byte with the left pixel in the high nibble.
+ */
+typedef struct {
+    uint8_t w;
+    uint8_t h;
+    uint16_t glyph_bytes;
+    const uint8_t *bitmaps;     // 10 glyphs back to back, '0' first
+} GFX_DigitFont;
+
+extern const GFX_DigitFont GFX_Digits24x32;
+extern const GFX_DigitFont GFX_Digits32x48;
+
+#endif /* INC_GFX_DIGITS_H_ */
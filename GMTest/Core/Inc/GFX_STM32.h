@@ -10,10 +10,29 @@
 
 #include <stdint.h>
 #include "ILI9341_STM32.h"
+#include "GFX_Digits.h"
 
 // A simple GFX-like text rendering system for STM32
 
+/* Where glyph cells end up. NULL (the default) draws to the panel, where
+ * opaque characters go out as one render op each; lcd_driver points it at
+ * the framebuffer while that is enabled.
+ */
+typedef void (*GFX_FillRectFn)(uint16_t x, uint16_t y,
+                               uint16_t w, uint16_t h, uint16_t color);
+
 void GFX_Init(void);
+void GFX_SetFillRectFn(GFX_FillRectFn fn);
+
+/* 1 (default): opaque characters are rendered as one address window.
+ * 0: per-dot-run fills, the old path; kept for benchmarking.
+ */
+void GFX_SetGlyphRuns(uint8_t enable);
+
+/* Large anti-aliased digits for '0'-'9' (and ' ' as a blank cell of the same
+ * size). Other characters keep using the scaled 5x7 font. NULL turns it off.
+ */
+void GFX_SetDigitFont(const GFX_DigitFont *font);
 
 void GFX_SetCursor(uint16_t x, uint16_t y);
 void GFX_SetTextSize(uint8_t size);
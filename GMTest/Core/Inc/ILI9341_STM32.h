@@ -29,6 +29,17 @@ extern "C" {
 #define ILI9341_RST_GPIO_Port   NULL
 #define ILI9341_RST_Pin         0
 
+/* Pixels in each DMA color line (one landscape row). Fills larger than
+ * this are sent as repeated DMA transfers of the same line.
+ */
+#define ILI9341_DMA_LINE_PIXELS 320
+
+/* Largest single DMA transfer for image data (HAL size is 16-bit) */
+#define ILI9341_DMA_MAX_CHUNK   32768U
+
+/* Draw ops buffered between the foreground and the SPI IRQ */
+#define ILI9341_QUEUE_LEN       64
+
 /* Screen size */
 #define ILI9341_TFTWIDTH   240
 #define ILI9341_TFTHEIGHT  320
@@ -127,6 +138,68 @@ void ILI9341_DrawFastHLine(uint16_t x, uint16_t y,
 void ILI9341_DrawFastVLine(uint16_t x, uint16_t y,
                            uint16_t h, uint16_t color);
 
+/* Blit big-endian RGB565 data. The buffer is read by DMA after the call
+ * returns and must stay valid until ILI9341_IsBusy() reports idle.
+ */
+void ILI9341_DrawImage(uint16_t x, uint16_t y, uint16_t w, uint16_t h,
+                       const uint8_t *data);
+
+/* Render ops: fn is called from the SPI IRQ to produce `count` pixels
+ * (big-endian RGB565 into out) starting at pixel `first` of the window,
+ * in row-major order. The job is copied into the queue; anything it points
+ * to must stay valid until the op has been sent.
+ */
+typedef struct {
+    uint16_t x, y, w, h;
+    uint16_t fg, bg;
+    const void *src;
+    uint32_t arg;
+} ILI9341_RenderJob;
+
+typedef void (*ILI9341_RenderFn)(const ILI9341_RenderJob *job,
+                                 uint32_t first, uint16_t count,
+                                 uint8_t *out);
+
+void ILI9341_DrawRendered(const ILI9341_RenderJob *job, ILI9341_RenderFn fn);
+
+/* Hardware scrolling along the panel's 320-line axis: screen y in portrait,
+ * screen x in landscape. Coordinates are screen positions on that axis for
+ * the current rotation; the driver maps them to the panel's lines.
+ * SetScrollArea makes [start, start + len) scroll and leaves the rest fixed,
+ * with the offset reset to 0. ScrollTo(n) shows the area's contents moved n
+ * lines towards `start`: position start + p displays what was drawn at
+ * start + (p + n) % len. Drawing still addresses the unscrolled positions.
+ * Both are queued in order with the drawing ops.
+ */
+void ILI9341_SetScrollArea(uint16_t start, uint16_t len);
+void ILI9341_ScrollTo(uint16_t offset);
+
+/* All drawing primitives push a draw op into a ring that the SPI1 TX
+ * complete interrupt drains by DMA, so they return without waiting for the
+ * panel. Only a full queue makes the caller wait (counted in stalls).
+ */
+typedef struct {
+    uint16_t depth;         // ops waiting right now
+    uint16_t high_water;    // deepest the queue has been
+    uint32_t stalls;        // pushes that had to wait for a free slot
+    uint32_t ops;           // ops sent to the panel
+} ILI9341_QueueStats;
+
+uint8_t ILI9341_IsBusy(void);
+void ILI9341_WaitIdle(void);
+void ILI9341_GetQueueStats(ILI9341_QueueStats *stats);
+
+/* Running totals of panel traffic, for comparing drawing paths */
+typedef struct {
+    uint32_t transfers;     // SPI transmit calls, blocking or DMA
+    uint32_t bytes;         // bytes clocked out
+    uint32_t windows;       // address windows (RAMWR) opened by the queue
+    uint32_t gpio_writes;   // CS/DC pin writes
+} ILI9341_BusStats;
+
+void ILI9341_GetBusStats(ILI9341_BusStats *stats);
+void ILI9341_ResetBusStats(void);
+
 /* If you want to build a GFX-like layer or use lcd_ui on top, you’ll call
  * these primitives from that layer.
  */
@@ -0,0 +1,137 @@
+/*
+ * acq.h
+ *
+ *  Created on: Oct 17, 2026
+ *      Author: kings
+ */
+
+#ifndef INC_ACQ_H_
+#define INC_ACQ_H_
+
+#include <stdint.h>
+#include "sample_ring.h"
+#include "filter.h"
+
+/* Glucose channel acquisition. TIM2 TRGO triggers ADC1 channel 8 and DMA1
+ * channel 1 moves every conversion into a circular buffer of two blocks.
+ * The DMA half- and full-transfer interrupts each copy the half that just
+ * filled into a timestamped sample ring (sample_ring.h); the main loop
+ * drains it with ACQ_GetBlock(). One interrupt per block, and a busy main
+ * loop only delays blocks until the ring fills.
+ *
+ * How the channel is sampled (sample time, hardware oversampling, trigger
+ * rate) comes from the selected profile, see ACQ_SetProfile(). Blocks are
+ * always ACQ_BLOCK_MS long whatever the rate.
+ */
+#define ACQ_BLOCK_MS        500U    // one block per half buffer
+#define ACQ_MAX_RATE_HZ     2000U   // highest profile rate, sizes the buffer
+#define ACQ_RING_LEN        2048U   // samples waiting for the main loop (2^n)
+
+#define ACQ_SPOT_OS_LOG2    8U      // x256 per spot reading, 16 bits kept
+#define ACQ_SPOT_TIMEOUT_MS 5U
+
+#define ACQ_ADC_CLOCK_HZ    48000000U   // ADC kernel clock (PLLSAI1R)
+#define ACQ_TIM_CLOCK_HZ    1000000U    // TIM2 counter clock after prescaler
+
+typedef enum {
+    ACQ_PROFILE_FAST = 0,       // short sample time, no oversampling
+    ACQ_PROFILE_BALANCED,       // default
+    ACQ_PROFILE_LOW_NOISE,      // long sample time, heavy oversampling
+    ACQ_PROFILE_LOW_POWER,      // light oversampling at a low rate
+    ACQ_PROFILE_COUNT
+} ACQ_ProfileId;
+
+typedef struct {
+    const char *name;
+    uint32_t sample_time;   // ADC_SAMPLETIME_x
+    uint16_t sample_x10;    // the same sample time in ADC clocks x10
+    uint8_t  os_log2;       // hardware oversampling ratio 1 << os_log2 (0: off)
+    uint8_t  os_shift;      // oversampler right shift, bits
+    uint16_t rate_hz;       // TIM2 trigger rate, divides ACQ_TIM_CLOCK_HZ
+} ACQ_Profile;
+
+/* What a profile costs and buys. cpu_cyc_x100 is measured (DWT cycles
+ * spent in the DMA callbacks per sample, copying into the ring) and stays 0 until the profile
+ * has produced a block.
+ */
+typedef struct {
+    uint8_t  out_bits;      // width of one DMA sample
+    uint8_t  enob_x10;      // effective resolution, 0.1 bit
+    uint32_t conv_ns;       // ADC busy time per output sample
+    uint16_t adc_duty_x10;  // ADC busy share of the trigger period, 0.1 %
+    uint32_t cpu_cyc_x100;  // CPU cycles per sample x100
+} ACQ_ProfileInfo;
+
+typedef struct {
+    uint32_t seq;       // block number since ACQ_Start
+    uint32_t tick;      // time of the last sample in the block, ms
+    uint16_t mean;      // average of the block, 12-bit ADC counts
+    uint16_t min;
+    uint16_t max;
+    uint16_t mean16;    // the same average at 16-bit full scale, keeps the
+                        // extra resolution of oversampled profiles
+    uint16_t filt16;    // newest output of the filter chain, 16-bit full
+                        // scale (mean16 while there is no chain)
+    uint16_t flags;     // SRING_FLAG_x of all samples in the block
+} ACQ_Block;
+
+typedef struct {
+    uint32_t blocks;    // DMA half buffers copied into the ring
+    uint32_t dropped;   // samples lost because the ring was full
+    uint32_t overruns;  // ADC overrun errors (DMA fell behind the ADC)
+    uint32_t high_water;// most samples ever waiting in the ring
+    uint32_t spot_cycles;// DWT cycles the last ACQ_Spot took
+} ACQ_Stats;
+
+void    ACQ_Start(void);
+void    ACQ_Stop(void);
+
+/* Spot sampling, for the low-power idle policy (low_power.h): TIM2 and
+ * the DMA stay off and each ACQ_Spot call converts one reading, software
+ * triggered, with the profile's sample time and x256 hardware
+ * oversampling; it waits for the conversion (well under a millisecond)
+ * and leaves the ADC disabled. Every reading is a block of its own, not
+ * passed through the filter chain (filt16 is mean16): the chain's corners
+ * are set for the profile rate and would sit far above a reading every
+ * few seconds, and the x256 oversampling already does the averaging. The
+ * ring still carries the readings, so the telemetry sink sees them too.
+ * ACQ_Stop ends it as usual.
+ */
+void    ACQ_StartSpot(void);
+uint8_t ACQ_Spot(void);
+
+/* What a spot reading is with the selected profile's sample time: only
+ * out_bits, enob_x10 and conv_ns apply. The CPU cost of the last one is
+ * ACQ_Stats.spot_cycles.
+ */
+void    ACQ_GetSpotInfo(ACQ_ProfileInfo *info);
+
+/* Selects the sampling profile. Restarts acquisition if it was running
+ * (the block in progress and queued blocks are discarded). Returns 0 if
+ * the id is out of range or the profile cannot keep up with its own rate.
+ */
+uint8_t ACQ_SetProfile(ACQ_ProfileId id);
+ACQ_ProfileId ACQ_GetProfile(void);
+const ACQ_Profile *ACQ_GetProfileDef(ACQ_ProfileId id);
+void    ACQ_GetProfileInfo(ACQ_ProfileId id, ACQ_ProfileInfo *info);
+
+/* Runs every block through the chain from now on (NULL: none). The chain
+ * is reset on ACQ_Start; its coefficients are for one sample rate, so
+ * changing profile changes its corner frequencies in proportion.
+ */
+void    ACQ_SetFilter(FLT_Chain *chain);
+
+/* Called with every sample ACQ_GetBlock takes off the ring, oldest first,
+ * in the main loop (NULL: none). For streaming the raw signal out.
+ */
+typedef void (*ACQ_SampleSink)(const SRING_Sample *s);
+void    ACQ_SetSampleSink(ACQ_SampleSink sink);
+
+/* Takes the oldest ACQ_BLOCK_MS worth of samples off the ring, reduces
+ * them and passes them through the filter chain. Returns 0 while fewer
+ * than that are waiting.
+ */
+uint8_t ACQ_GetBlock(ACQ_Block *blk);
+void    ACQ_GetStats(ACQ_Stats *stats);
+
+#endif /* INC_ACQ_H_ */
@@ -0,0 +1,76 @@
+/*
+ * alarm.h
+ *
+ *  Created on: Oct 17, 2026
+ *      Author: kings
+ */
+
+#ifndef INC_ALARM_H_
+#define INC_ALARM_H_
+
+#include <stdint.h>
+#include "trend.h"
+
+/* Glucose alarms. Each kind runs its own small state machine:
+ *
+ *   IDLE -> PENDING      condition seen
+ *   PENDING -> IDLE      condition gone before on_delay_ms (debounce)
+ *   PENDING -> ACTIVE    condition held for on_delay_ms
+ *   ACTIVE -> SILENCED   Alarm_Acknowledge()
+ *   SILENCED -> ACTIVE   silence_ms ran out and the condition is still on
+ *   ACTIVE/SILENCED -> IDLE
+ *                        past the hysteresis band, and active for at least
+ *                        min_on_ms
+ *
+ * Pure logic on values and a millisecond clock passed in, no HAL calls,
+ * so it builds and can be exercised on a PC. The buzzer is driven from
+ * Alarm_Sounding() by the caller.
+ */
+
+typedef enum {
+    ALARM_LOW = 0,      // below lower limit, or predicted to be soon
+    ALARM_HIGH,         // above upper limit, or predicted to be soon
+    ALARM_RAPID,        // rate of change beyond rate_limit either way
+    ALARM_COUNT,
+    ALARM_NONE = ALARM_COUNT
+} Alarm_Kind;           // in order of severity
+
+typedef enum {
+    ALARM_IDLE = 0,
+    ALARM_PENDING,
+    ALARM_ACTIVE,
+    ALARM_SILENCED,
+} Alarm_State;
+
+typedef struct {
+    int32_t  lower;         // mg/dL Q16
+    int32_t  upper;         // mg/dL Q16
+    int32_t  level_hyst;    // mg/dL Q16, back inside by this much to clear
+    int32_t  rate_limit;    // mg/dL/min Q16
+    int32_t  rate_hyst;     // mg/dL/min Q16
+    uint32_t predict_s;     // predicted crossings this close count (0: off)
+    uint32_t on_delay_ms;
+    uint32_t min_on_ms;
+    uint32_t silence_ms;
+} Alarm_Config;
+
+typedef struct {
+    int32_t     value;      // mg/dL Q16
+    int32_t     slope;      // mg/dL/min Q16
+    uint8_t     slope_valid;
+    TREND_Limit predicted;  // from TREND_Predict
+    uint32_t    predict_s;  // seconds until the predicted crossing
+} Alarm_Input;
+
+void Alarm_Init(const Alarm_Config *cfg);
+
+/* Call once per new reading; returns a bit per kind whose state changed */
+uint8_t     Alarm_Update(uint32_t now, const Alarm_Input *in);
+void        Alarm_Acknowledge(uint32_t now);
+Alarm_State Alarm_GetState(Alarm_Kind kind);
+
+/* Most severe alarm that should be heard now, ALARM_NONE if none */
+Alarm_Kind  Alarm_Sounding(void);
+const char *Alarm_Name(Alarm_Kind kind);
+
+#endif /* INC_ALARM_H_ */
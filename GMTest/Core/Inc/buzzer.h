@@ -0,0 +1,33 @@
+/*
+ * buzzer.h
+ *
+ *  Created on: Oct 17, 2026
+ *      Author: kings
+ */
+
+#ifndef INC_BUZZER_H_
+#define INC_BUZZER_H_
+
+#include <stdint.h>
+
+/* Buzzer on PA10, driven by TIM1 CH3 PWM (see MX_TIM1_Init). A pattern is
+ * a bit per 100 ms slot, bit 0 first, repeated every `slots` slots; the
+ * TIM1 update interrupt steps through it, so playing costs the main loop
+ * nothing and timing does not depend on it.
+ */
+#define BUZZER_SLOT_MS      100U
+#define BUZZER_DUTY_PCT     50U     // 100 for a self-oscillating buzzer
+
+typedef struct {
+    uint32_t bits;      // slot i sounds if bit i is set
+    uint8_t  slots;     // pattern length, 1..32
+} Buzzer_Pattern;
+
+void Buzzer_Init(void);
+
+/* Starts the pattern from its first slot, unless it is already playing.
+ * NULL stops the buzzer.
+ */
+void Buzzer_Play(const Buzzer_Pattern *pattern);
+
+#endif /* INC_BUZZER_H_ */
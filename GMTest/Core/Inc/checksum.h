@@ -0,0 +1,20 @@
+/*
+ * checksum.h
+ *
+ *  Created on: Oct 17, 2026
+ *      Author: kings
+ */
+
+#ifndef INC_CHECKSUM_H_
+#define INC_CHECKSUM_H_
+
+#include <stdint.h>
+#include <stddef.h>
+
+/* CRC-32 (IEEE 802.3, reflected, init and final XOR 0xFFFFFFFF), the one
+ * zlib and Python's binascii.crc32 compute. Pass 0 as crc to start, or a
+ * previous result to continue over more data.
+ */
+uint32_t CSUM_Crc32(uint32_t crc, const void *data, size_t len);
+
+#endif /* INC_CHECKSUM_H_ */
@@ -0,0 +1,114 @@
+/*
+ * filter.h
+ *
+ *  Created on: Oct 17, 2026
+ *      Author: kings
+ */
+
+#ifndef INC_FILTER_H_
+#define INC_FILTER_H_
+
+#include <stdint.h>
+
+/* Sample-path filters, written as CMSIS-DSP style block functions on Q31
+ * data: each takes an instance, a source block and a destination block
+ * (which may be the same buffer) and keeps its history in the instance,
+ * so consecutive DMA blocks filter as one continuous stream.
+ *
+ * FLT_Chain strings them together: spike-rejecting median, decimating
+ * CIC (order 1 is a moving average), then a biquad cascade. Everything is
+ * statically allocated; a stage is skipped when its config leaves it off.
+ */
+
+typedef int32_t q31_t;
+
+#define FLT_MEDIAN_MAX          7U  // longest median window (odd)
+#define FLT_CIC_MAX_ORDER       3U
+#define FLT_BIQUAD_MAX_STAGES   2U
+
+/* ======== Block functions ======== */
+
+typedef struct {
+    uint8_t len;                    // window, odd, 1 passes through
+    uint8_t pos;                    // oldest entry in hist
+    q31_t   hist[FLT_MEDIAN_MAX];
+} FLT_MedianInst_q31;
+
+void FLT_MedianInit_q31(FLT_MedianInst_q31 *s, uint8_t len, q31_t fill);
+void FLT_Median_q31(FLT_MedianInst_q31 *s, const q31_t *src, q31_t *dst,
+                    uint32_t n);
+
+typedef struct {
+    uint8_t  order;                 // 1..FLT_CIC_MAX_ORDER
+    uint8_t  log2r;                 // decimation R = 1 << log2r
+    uint16_t phase;                 // inputs since the last output
+    uint64_t integ[FLT_CIC_MAX_ORDER];  // wrap-around is intended
+    uint64_t comb[FLT_CIC_MAX_ORDER];
+} FLT_CicInst_q31;
+
+void     FLT_CicInit_q31(FLT_CicInst_q31 *s, uint8_t order, uint8_t log2r);
+/* Returns the number of outputs written, n >> log2r give or take one */
+uint32_t FLT_CicDecimate_q31(FLT_CicInst_q31 *s, const q31_t *src, q31_t *dst,
+                             uint32_t n);
+
+/* Direct form I, CMSIS arm_biquad_cascade_df1_q31 layout: five
+ * coefficients per stage {b0, b1, b2, a1, a2}, feedback terms added (a1,
+ * a2 negated with respect to the usual transfer function), all scaled by
+ * 2^-post_shift so that a1 fits in Q31.
+ */
+typedef struct {
+    uint8_t      stages;
+    uint8_t      post_shift;
+    const q31_t *coefs;
+    q31_t        state[4 * FLT_BIQUAD_MAX_STAGES];  // x1, x2, y1, y2
+} FLT_BiquadInst_q31;
+
+void FLT_BiquadInit_q31(FLT_BiquadInst_q31 *s, uint8_t stages,
+                        const q31_t *coefs, uint8_t post_shift);
+/* Sets every delay to x, the steady state for a constant input x (unity
+ * DC gain), so the filter starts without a step response
+ */
+void FLT_BiquadPrime_q31(FLT_BiquadInst_q31 *s, q31_t x);
+void FLT_Biquad_q31(FLT_BiquadInst_q31 *s, const q31_t *src, q31_t *dst,
+                    uint32_t n);
+
+/* ======== Chain ======== */
+
+typedef struct {
+    uint8_t      median_len;    // 1 (off), 3, 5 or 7
+    uint8_t      cic_order;     // 0 (off) .. FLT_CIC_MAX_ORDER
+    uint8_t      cic_log2r;     // CIC decimation, R = 1 << cic_log2r
+    uint8_t      biquad_stages; // 0 (off) .. FLT_BIQUAD_MAX_STAGES
+    uint8_t      biquad_shift;
+    const q31_t *biquad_coefs;  // designed for the rate after the CIC
+} FLT_Config;
+
+typedef struct {
+    uint32_t in_samples;
+    uint32_t out_samples;
+    uint32_t last_cycles;       // DWT cycles of the last FLT_ChainProcess
+    uint32_t cyc_x100;          // the same per input sample, x100
+} FLT_Stats;
+
+typedef struct {
+    FLT_Config         cfg;
+    FLT_MedianInst_q31 median;
+    FLT_CicInst_q31    cic;
+    FLT_BiquadInst_q31 biquad;
+    uint8_t            settled;     // CIC start-up outputs dropped so far
+    uint8_t            median_primed;
+    uint8_t            biquad_primed;
+    FLT_Stats          stats;
+} FLT_Chain;
+
+void     FLT_ChainInit(FLT_Chain *c, const FLT_Config *cfg);
+void     FLT_ChainReset(FLT_Chain *c);
+/* Filters n samples from src into dst (may alias) and returns how many
+ * came out. The CIC start-up transient is swallowed, and the median and
+ * biquad are primed with the first value, so every output is usable.
+ */
+uint32_t FLT_ChainProcess(FLT_Chain *c, const q31_t *src, q31_t *dst,
+                          uint32_t n);
+void     FLT_ChainGetStats(const FLT_Chain *c, FLT_Stats *stats);
+
+#endif /* INC_FILTER_H_ */
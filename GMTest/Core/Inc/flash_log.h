@@ -0,0 +1,103 @@
+/*
+ * flash_log.h
+ *
+ *  Created on: Oct 17, 2026
+ *      Author: kings
+ */
+
+#ifndef INC_FLASH_LOG_H_
+#define INC_FLASH_LOG_H_
+
+#include <stdint.h>
+
+/* Append-only log in flash bank 2 (0x08080000-0x080FFFFF, kept out of the
+ * image by STM32L475RGTX_FLASH.ld). The pages form a ring written in
+ * order, so every page is erased once per lap and wear is even; when the
+ * ring is full the oldest page goes.
+ *
+ * Page:  header double word {sequence number, its complement}, then
+ *        entries.
+ * Entry: header double word {length (u16), type (u8), check (u8), CRC-32
+ *        of the payload}, then the payload padded to whole double words.
+ *
+ * An entry's payload is programmed before its header, so an entry exists
+ * once its header is in flash and a torn one leaves no valid header.
+ * Programming only clears bits, so a torn page header never matches its
+ * complement, and a torn entry header fails its check or CRC. Recovery
+ * on boot finds the newest page by sequence number and walks it; anything
+ * torn closes that page and logging carries on in the next.
+ *
+ * Writes never wait for the flash. Appends queue double-word program and
+ * page erase operations that the flash interrupt runs one after another,
+ * and FLOG_SPARE_PAGES pages ahead of the head are always erased or
+ * queued for erasing. Bank 2 can be programmed and erased while code runs
+ * from bank 1; only reads of bank 2 stall during an erase.
+ */
+#define FLOG_ADDR           0x08080000U
+#ifndef FLOG_PAGES
+#define FLOG_PAGES          256U    // the host models build bigger logs too
+#endif
+#define FLOG_SPARE_PAGES    2U
+#define FLOG_QUEUE_LEN      128U    // pending flash operations, power of two
+#define FLOG_MAX_ENTRY      256U    // payload bytes
+
+typedef struct {
+    uint8_t        type;
+    uint16_t       len;
+    const uint8_t *data;            // in flash, memory mapped
+} FLOG_Entry;
+
+/* Walks entries oldest first. At the end it stays put, and picks up
+ * entries committed later on the next call.
+ */
+typedef struct {
+    uint32_t seq;                   // sequence number of the page
+    uint32_t off;                   // next entry header within it
+} FLOG_Iter;
+
+typedef struct {
+    uint32_t appended;              // entries queued
+    uint32_t committed;             // entries whose header is in flash
+    uint32_t dropped;               // entries refused: queue full or too long
+    uint32_t errors;                // flash operations that failed
+    uint32_t erases;                // pages erased
+    uint32_t pages;                 // pages in the log, head included
+    uint32_t recovered;             // boots that closed a torn page
+} FLOG_Stats;
+
+/* Unlocks the flash, finds the log and queues any erases it needs. Any
+ * state from before (a reset) is dropped first.
+ */
+void     FLOG_Init(void);
+
+/* Queues one entry, type 0x01..0xFE. Returns 0 if it was dropped. */
+uint8_t  FLOG_Append(uint8_t type, const void *data, uint16_t len);
+
+/* 1 while flash operations are pending */
+uint8_t  FLOG_Busy(void);
+
+/* Position of the entry the last successful FLOG_Append queued; an
+ * iterator set to it returns that entry next once it is in flash.
+ */
+void     FLOG_LastAppended(FLOG_Iter *at);
+
+/* Starts the next queued operation; call from FLASH_IRQHandler after
+ * HAL_FLASH_IRQHandler, which holds the HAL flash lock during callbacks.
+ */
+void     FLOG_IRQHandler(void);
+
+void     FLOG_IterInit(FLOG_Iter *it);
+uint8_t  FLOG_Next(FLOG_Iter *it, FLOG_Entry *e);
+
+/* FLOG_Next checking entry headers only, not payload CRCs: for a quick
+ * walk that can live with a damaged payload.
+ */
+uint8_t  FLOG_Skim(FLOG_Iter *it, FLOG_Entry *e);
+
+/* Raw pages from the oldest to the head, for export (LOGX_Source) */
+uint32_t FLOG_Size(void);
+uint32_t FLOG_Read(uint32_t offset, uint8_t *buf, uint32_t len);
+
+void     FLOG_GetStats(FLOG_Stats *stats);
+
+#endif /* INC_FLASH_LOG_H_ */
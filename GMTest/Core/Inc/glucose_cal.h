@@ -0,0 +1,71 @@
+/*
+ * glucose_cal.h
+ *
+ *  Created on: Oct 17, 2026
+ *      Author: kings
+ */
+
+#ifndef INC_GLUCOSE_CAL_H_
+#define INC_GLUCOSE_CAL_H_
+
+#include <stdint.h>
+
+/* ADC -> mg/dL calibration. The input is a sample at 16-bit full scale
+ * (ACQ_Block.mean16), the output is mg/dL in Q16. Evaluation is integer
+ * only: a piecewise-linear curve through up to CAL_MAX_POINTS knots, or a
+ * polynomial, after an offset and before a temperature correction.
+ *
+ * The curve comes from a CAL_Record, which is versioned and CRC-protected
+ * so it can be stored in flash and checked before use.
+ */
+
+#define CAL_MAGIC       0x4C414347U     // "GCAL"
+#define CAL_VERSION     1U
+#define CAL_MAX_POINTS  8U
+
+typedef enum {
+    CAL_CURVE_PWL = 0,      // y = linear between (x[i], y[i]) knots
+    CAL_CURVE_POLY,         // y = sum y[k] * u^k, u = x / 65536
+} CAL_CurveType;
+
+typedef struct {
+    uint32_t magic;         // CAL_MAGIC
+    uint16_t version;       // CAL_VERSION
+    uint8_t  curve;         // CAL_CurveType
+    uint8_t  npoints;       // knots (PWL, 2..) or coefficients (POLY, 1..)
+    int32_t  offset;        // subtracted from the sample first, 16-bit counts
+    uint16_t x[CAL_MAX_POINTS];     // PWL knots, strictly ascending
+    int32_t  y[CAL_MAX_POINTS];     // PWL knot values / POLY coefficients, Q16
+    int16_t  temp_ref;      // temperature the curve was taken at, 0.1 degC
+    int16_t  reserved;
+    int32_t  temp_coef;     // sensitivity change per degC, Q16 (0.03 = 3 %)
+    uint32_t serial;        // sensor lot / calibration run, for the logs
+    uint32_t crc;           // CSUM_Crc32 over everything above
+} CAL_Record;
+
+typedef struct {
+    uint32_t conversions;
+    uint32_t last_cycles;   // DWT cycles of the last CAL_Convert
+    uint32_t max_cycles;
+} CAL_Stats;
+
+/* Loads the built-in placeholder curve */
+void     CAL_Init(void);
+
+/* Checks magic, version, CRC and curve shape, then makes the record the
+ * active calibration. Returns 0 and keeps the old one if anything is off.
+ */
+uint8_t  CAL_Load(const CAL_Record *rec);
+const CAL_Record *CAL_Get(void);
+
+/* Fills in crc, for tools that build or edit a record */
+void     CAL_Seal(CAL_Record *rec);
+
+/* Sensor temperature for the correction, 0.1 degC */
+void     CAL_SetTemperature(int16_t temp);
+
+/* 16-bit sample -> mg/dL Q16, never negative; saturates at INT32_MAX */
+int32_t  CAL_Convert(uint16_t raw16);
+void     CAL_GetStats(CAL_Stats *stats);
+
+#endif /* INC_GLUCOSE_CAL_H_ */
@@ -10,6 +10,7 @@
 
 #include <stdint.h>
 #include "ILI9341_STM32.h"
+#include "GFX_Digits.h"
 
 // Generic names expected by lcd_ui
 #define LCD_BLACK     ILI9341_BLACK
@@ -30,10 +31,40 @@ void LCD_DrawPixel(uint16_t x, uint16_t y, uint16_t color);
 void LCD_DrawFastVLine(uint16_t x, uint16_t y, uint16_t h, uint16_t color);
 void LCD_DrawFastHLine(uint16_t x, uint16_t y, uint16_t w, uint16_t color);
 
+/* Optional RAM2 framebuffer (see lcd_fb.h). Once enabled, drawing only
+ * updates RAM and LCD_Flush() sends the changed tiles to the panel.
+ */
+void LCD_EnableFramebuffer(const uint16_t palette[4]);
+void LCD_Flush(void);
+
+/* An area the framebuffer leaves alone, for drawing its four colors cannot
+ * show. LCD_Flush() never covers it, and between LCD_SetDirect(1) and
+ * LCD_SetDirect(0) drawing goes straight to the panel. Both do nothing
+ * without the framebuffer, where all drawing is direct.
+ */
+void LCD_SetDirectArea(uint16_t x, uint16_t y, uint16_t w, uint16_t h);
+void LCD_SetDirect(uint8_t direct);
+
+/* One graph column as a single address window: bg over [y, y + h) with
+ * `color` over rows span_y0..span_y1 (inclusive, clipped to the column).
+ */
+void LCD_DrawColumn(uint16_t x, uint16_t y, uint16_t h, uint16_t bg,
+                    uint16_t span_y0, uint16_t span_y1, uint16_t color);
+
+/* Hardware scrolling, see ILI9341_SetScrollArea */
+void LCD_SetScrollArea(uint16_t start, uint16_t len);
+void LCD_ScrollTo(uint16_t offset);
+
+/* Drawing is queued and streamed by DMA in the background */
+uint8_t LCD_IsBusy(void);
+void LCD_GetQueueStats(ILI9341_QueueStats *stats);
+
 /* Text functions (via GFX or custom text renderer) */
 void LCD_SetCursor(uint16_t x, uint16_t y);
 void LCD_SetTextSize(uint8_t size);
 void LCD_SetTextColor(uint16_t color);
+void LCD_SetTextBgColor(uint16_t color);
+void LCD_SetDigitFont(const GFX_DigitFont *font);   // NULL: scaled 5x7 digits
 void LCD_Print(const char *str);
 void LCD_DrawLine(uint16_t x0, uint16_t y0,
                   uint16_t x1, uint16_t y1,
@@ -0,0 +1,54 @@
+/*
+ * lcd_fb.h
+ *
+ *  Created on: Oct 17, 2026
+ *      Author: kings
+ */
+
+#ifndef INC_LCD_FB_H_
+#define INC_LCD_FB_H_
+
+#include <stdint.h>
+
+/*
+ * Optional tile framebuffer kept in RAM2.
+ *
+ * A full 320x240 RGB565 frame does not fit in the 32 KB RAM2 bank, so the
+ * framebuffer stores 2 bits per pixel (19200 bytes) against a 4-entry
+ * palette. lcd_ui only uses four colors; anything else is mapped to the
+ * nearest palette entry.
+ *
+ * Drawing marks 32x16 tiles dirty. LCD_FB_Flush() merges dirty tiles into
+ * as few rectangles as it can and queues one render op per rectangle; the
+ * SPI IRQ expands the indexed pixels to RGB565 on the fly.
+ */
+
+#define LCD_FB_W        320
+#define LCD_FB_H        240
+
+#define LCD_FB_TILE_W   32
+#define LCD_FB_TILE_H   16
+#define LCD_FB_TILES_X  (LCD_FB_W / LCD_FB_TILE_W)     // 10
+#define LCD_FB_TILES_Y  (LCD_FB_H / LCD_FB_TILE_H)     // 15
+
+#define LCD_FB_COLORS   4
+
+void LCD_FB_Init(const uint16_t palette[LCD_FB_COLORS]);
+
+void LCD_FB_FillRect(uint16_t x, uint16_t y, uint16_t w, uint16_t h,
+                     uint16_t color);
+void LCD_FB_DrawPixel(uint16_t x, uint16_t y, uint16_t color);
+
+/* One rectangle left to be drawn straight to the panel, for what four
+ * colors cannot show (the anti-aliased readout). Flushes send the dirty
+ * regions around it and never cover it. w or h 0 removes it; so does
+ * LCD_FB_Init().
+ */
+void LCD_FB_SetDirectArea(uint16_t x, uint16_t y, uint16_t w, uint16_t h);
+
+/* Queue every dirty region to the panel. Returns the number of rectangles
+ * (address windows) that were queued.
+ */
+uint16_t LCD_FB_Flush(void);
+
+#endif /* INC_LCD_FB_H_ */
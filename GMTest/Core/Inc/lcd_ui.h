@@ -14,6 +14,17 @@ extern "C" {
 
 #include <stdint.h>
 
+/**
+ * @brief Trend graph time windows. Every window is kept up to date, so
+ *        switching between them is immediate.
+ */
+typedef enum {
+    LCD_UI_TREND_5MIN = 0,
+    LCD_UI_TREND_1H,
+    LCD_UI_TREND_8H,
+    LCD_UI_TREND_COUNT
+} LCD_UI_TrendWindow;
+
 /**
  * @brief Initialize the LCD UI layout.
  *
@@ -53,6 +64,35 @@ void LCD_UI_AddSample(uint16_t raw_value);
  */
 void LCD_UI_ClearGraph(void);
 
+/**
+ * @brief Set the time between LCD_UI_AddSample() calls, so the trend
+ *        windows cover the time they are labelled with.
+ *
+ * Defaults to one ADC block (500 ms). A change clears the graph.
+ *
+ * @param period_ms  Sample period in milliseconds.
+ */
+void LCD_UI_SetSamplePeriod(uint32_t period_ms);
+
+/**
+ * @brief Show a different time window on the trend graph.
+ *
+ * Each column is drawn as the min..max of the samples it covers. The
+ * history is kept for all windows at once, so this only redraws the graph.
+ *
+ * @param window  LCD_UI_TREND_5MIN, LCD_UI_TREND_1H or LCD_UI_TREND_8H.
+ */
+void LCD_UI_SetTrendWindow(LCD_UI_TrendWindow window);
+
+/**
+ * @brief Send everything drawn since the last flush to the panel.
+ *
+ * In framebuffer mode, value and graph updates only touch RAM; call this
+ * once per frame (e.g., after each sample) so the changed tiles go out in
+ * one burst. Without the framebuffer it does nothing.
+ */
+void LCD_UI_Flush(void);
+
 #ifdef __cplusplus
 }
 #endif
@@ -0,0 +1,83 @@
+/*
+ * log_codec.h
+ *
+ *  Created on: Oct 17, 2026
+ *      Author: kings
+ */
+
+#ifndef INC_LOG_CODEC_H_
+#define INC_LOG_CODEC_H_
+
+#include <stdint.h>
+
+/* Compact reading blocks for the session log. Readings come at a fixed
+ * cadence and move by a few counts, so a block stores the first reading
+ * in full (the keyframe) and the rest as deltas:
+ *
+ *     tick0 (u32, ms), value0 (u16), period (u16, ms), flags (u16),
+ *     count (u8), width (u8), then count - 1 deltas
+ *
+ * all little endian. A delta is value[i] - value[i-1] mod 2^16, zigzag
+ * mapped (0, -1, 1, -2, ... -> 0, 1, 2, 3, ...), then either packed at
+ * width bits each, LSB first (width 0..16, 0 when all are zero), or as
+ * LEB128 varints (width LOGC_VARINT), whichever is shorter for the block.
+ *
+ * Reading i is at tick0 + i * period and carries the block's flags; one
+ * off the cadence, with other flags, LOGC_BLOCK_MS or more after the
+ * first, or past LOGC_MAX_SAMPLES starts a new block. The open block is
+ * in RAM only, so LOGC_BLOCK_MS bounds what a reset loses whatever the
+ * reading rate. Each block decodes on its own, so the log can be entered at
+ * any block header. Tools/codec_bench round-trips and times the codec.
+ */
+#define LOGC_BLOCK_MS       60000U  // one block spans under a minute
+#define LOGC_MAX_SAMPLES    120U    // a minute of 500 ms ADC blocks
+#define LOGC_HEADER_LEN     12U
+#define LOGC_MAX_BLOCK      (LOGC_HEADER_LEN + 2U * (LOGC_MAX_SAMPLES - 1U))
+#define LOGC_VARINT         0xFFU
+
+typedef struct {
+    uint32_t tick;
+    uint16_t value;
+    uint16_t flags;
+} LOGC_Sample;
+
+/* Gets each finished block, LOGC_MAX_BLOCK bytes at most */
+typedef void (*LOGC_BlockSink)(const uint8_t *block, uint16_t len);
+
+typedef struct {
+    uint32_t samples;
+    uint32_t blocks;
+    uint32_t bytes;             // block bytes out, headers included
+} LOGC_Stats;
+
+typedef struct {
+    LOGC_BlockSink sink;
+    LOGC_Sample    key;         // first reading of the open block
+    uint16_t       period;      // 0 until the second reading
+    uint16_t       prev;
+    uint8_t        count;
+    uint16_t       zz_or;       // all deltas or'd: the packed width
+    uint16_t       varint_len;
+    uint16_t       zz[LOGC_MAX_SAMPLES - 1U];
+    LOGC_Stats     stats;
+} LOGC_Encoder;
+
+void     LOGC_Init(LOGC_Encoder *enc, LOGC_BlockSink sink);
+
+/* Adds one reading; the open block goes to the sink first if this one
+ * does not fit it.
+ */
+void     LOGC_Add(LOGC_Encoder *enc, uint32_t tick, uint16_t value, uint16_t flags);
+
+/* Sends the open block, if any, as it is */
+void     LOGC_Flush(LOGC_Encoder *enc);
+
+void     LOGC_GetStats(const LOGC_Encoder *enc, LOGC_Stats *stats);
+
+/* Readings in a block, up to max of them into out; 0 if it is malformed */
+uint8_t  LOGC_Decode(const uint8_t *block, uint16_t len, LOGC_Sample *out, uint8_t max);
+
+/* Tick of the first reading, and of the last; 0 if len is too short */
+uint8_t  LOGC_BlockSpan(const uint8_t *block, uint16_t len, uint32_t *first, uint32_t *last);
+
+#endif /* INC_LOG_CODEC_H_ */
@@ -0,0 +1,54 @@
+/*
+ * log_export.h
+ *
+ *  Created on: Oct 17, 2026
+ *      Author: kings
+ */
+
+#ifndef INC_LOG_EXPORT_H_
+#define INC_LOG_EXPORT_H_
+
+#include <stdint.h>
+
+/* Session log dump over the USB CDC port. The host sends "dump" (any line
+ * ending) and gets a TLM_TYPE_EXPORT frame, the raw log bytes and a
+ * TLM_TYPE_EXPORT_END frame with their CRC-32; "stop" ends a dump early
+ * (the END frame then carries the shorter length). Telemetry is paused
+ * for the duration.
+ *
+ * The log goes out in LOGX_CHUNK_LEN chunks through the two halves of
+ * UserTxBufferFS: the main loop fills one while the other is on the wire,
+ * and the transmit complete IRQ starts the next filled chunk at once, so
+ * the link stays busy as long as the main loop comes round within one
+ * chunk time (about 2 ms at USB FS bulk speed).
+ */
+#define LOGX_CHUNK_LEN      2048U
+
+typedef struct {
+    uint32_t (*size)(void);
+    /* Copies up to len bytes from offset; returns how many */
+    uint32_t (*read)(uint32_t offset, uint8_t *buf, uint32_t len);
+} LOGX_Source;
+
+typedef struct {
+    uint32_t exports;       // dumps finished, stopped ones included
+    uint32_t last_bytes;    // log bytes in the last dump
+    uint32_t last_ms;       // its duration, command to last chunk out
+    uint32_t chunks;        // transfers started
+} LOGX_Stats;
+
+/* NULL exports an empty log */
+void    LOGX_SetSource(const LOGX_Source *src);
+
+/* CDC_Receive_FS side (USB IRQ): picks commands out of the OUT data */
+void    LOGX_Receive(const uint8_t *buf, uint32_t len);
+
+/* CDC_TransmitCplt_FS side (USB IRQ) */
+void    LOGX_TxComplete(void);
+
+/* Runs commands and refills chunks; call every main loop pass */
+void    LOGX_Poll(void);
+uint8_t LOGX_Busy(void);
+void    LOGX_GetStats(LOGX_Stats *stats);
+
+#endif /* INC_LOG_EXPORT_H_ */
@@ -0,0 +1,64 @@
+/*
+ * log_index.h
+ *
+ *  Created on: Oct 17, 2026
+ *      Author: kings
+ */
+
+#ifndef INC_LOG_INDEX_H_
+#define INC_LOG_INDEX_H_
+
+#include <stdint.h>
+#include "flash_log.h"
+#include "log_codec.h"
+
+/* Sparse time index over the session log, kept in RAM.
+ *
+ * Every session log entry starts with its log time (u32, ms): HAL_GetTick
+ * plus a base that carries on from the newest entry found at boot, so
+ * times keep rising across resets and a range can be searched for. Each
+ * entry of the reading block type (LOGC blocks, whose tick0 is that log
+ * time) is a candidate; every stride-th one goes into the index with its
+ * position. When the index is full every other entry is dropped and the
+ * stride doubles, so its size is fixed however long the log gets; entries
+ * whose page has left the ring are dropped as they are met.
+ *
+ * A range query is a binary search to the nearest indexed block before
+ * it, then a walk of at most about stride blocks to get there. Times are
+ * compared by difference, so they may wrap.
+ */
+#define LIDX_MAX_ENTRIES    128U
+
+typedef struct {
+    uint32_t entries;       // in use
+    uint32_t stride;        // reading blocks per index entry
+    uint32_t blocks;        // reading blocks seen, at boot and since
+    uint32_t walked;        // log entries walked at boot
+} LIDX_Stats;
+
+/* Walks the log (headers only, FLOG_Skim) to rebuild the index and pick
+ * this session's time base. Call after FLOG_Init, before anything is
+ * appended.
+ */
+void     LIDX_Init(uint8_t block_type);
+
+/* Log time of a HAL_GetTick value in this session */
+uint32_t LIDX_Time(uint32_t tick);
+
+/* Call after a reading block was appended (FLOG_Append returned 1) */
+void     LIDX_AddBlock(const uint8_t *block, uint16_t len);
+
+/* Iterator at the last indexed block at or before time, or at the oldest
+ * entry when there is none.
+ */
+void     LIDX_Seek(FLOG_Iter *it, uint32_t time);
+
+/* Readings from <= tick <= to (log times) into out, oldest first, up to
+ * max; returns how many. Only what is in flash counts: a block still
+ * open in the LOGC encoder, or queued in FLOG, is not there yet.
+ */
+uint32_t LIDX_Read(uint32_t from, uint32_t to, LOGC_Sample *out, uint32_t max);
+
+void     LIDX_GetStats(LIDX_Stats *stats);
+
+#endif /* INC_LOG_INDEX_H_ */
@@ -0,0 +1,93 @@
+/*
+ * low_power.h
+ *
+ *  Created on: Oct 17, 2026
+ *      Author: kings
+ */
+
+#ifndef INC_LOW_POWER_H_
+#define INC_LOW_POWER_H_
+
+#include <stdint.h>
+
+/* Idle policy for the main loop. When a pass has nothing left to do the
+ * core waits for the next interrupt in Sleep (clocks running, so TIM2,
+ * DMA, UART, SPI and USB carry on), or in Stop2 when the caller says
+ * nothing needs the clocks. LPTIM1, clocked from the LSI, keeps running
+ * in Stop2 and wakes the core once per period; that is the sample clock
+ * for spot sampling (ACQ_StartSpot), signalled to the main loop as
+ * EVT_SPOT_DUE from LPTIM1_IRQHandler.
+ *
+ * Stop2 comes back on MSI with SysTick stopped: HAL_GetTick is moved on
+ * by the time LPTIM1 counted asleep, then the clock restore callback
+ * (SystemClock_Config and PeriphCommonClock_Config) runs with interrupts
+ * enabled, so the HAL timeouts in it can expire. LPTIM1 is also the time
+ * base for the figures below, at 1 / (LSI / prescaler) resolution.
+ *
+ * Energy per sample is a model, not a measurement: the time spent in
+ * each mode between two samples times the datasheet supply current of
+ * that mode (LPM_x_NA, STM32L475 at 3.3 V, 80 MHz, range 1).
+ */
+#define LPM_LSI_HZ          32000U
+#define LPM_VDD_MV          3300U
+#define LPM_RUN_NA          10000000U   // run from flash, peripherals on
+#define LPM_SLEEP_NA        3000000U    // sleep, peripherals on
+#define LPM_STOP2_NA        1500U       // Stop2, LPTIM1 on LSI
+
+typedef enum {
+    LPM_RUN = 0,
+    LPM_SLEEP,
+    LPM_STOP2,
+    LPM_MODE_COUNT
+} LPM_Mode;
+
+/* One sample period, from LPM_Sampled to the next */
+typedef struct {
+    uint32_t samples;       // since LPM_Init
+    uint32_t period_us;
+    uint32_t mode_us[LPM_MODE_COUNT];   // time spent in each
+    uint32_t wake_us;       // Stop2 wake to clocks back, 0 if not woken
+                            // from Stop2 by LPTIM1
+    uint32_t latency_us;    // LPTIM1 wake to LPM_Sampled, the same
+    uint32_t energy_nj;     // estimated, see above
+    uint32_t avg_na;        // the same as average supply current
+} LPM_Measure;
+
+typedef struct {
+    uint32_t sleeps;        // WFI in Sleep
+    uint32_t stops;         // WFI in Stop2
+    uint32_t wakes;         // LPTIM1 periods
+} LPM_Stats;
+
+typedef void (*LPM_ClockRestore)(void);
+typedef void (*LPM_MeasureHook)(const LPM_Measure *m);
+
+/* Starts LPTIM1 with a wake every period_ms (up to 4 minutes; the longer
+ * the period, the coarser the count). restore brings the clocks back
+ * after Stop2.
+ */
+void    LPM_Init(uint32_t period_ms, LPM_ClockRestore restore);
+
+/* Waits for the next interrupt, in Stop2 if stop_ok is set, else in
+ * Sleep. Call with interrupts disabled, once nothing is pending
+ * (SCHED_Pending), so a wake source that fired since cannot be slept
+ * through; returns with the clocks as they were and interrupts
+ * disabled again. After Stop2 they are enabled around the clock restore,
+ * so the wake interrupt may already have run.
+ */
+void    LPM_Idle(uint8_t stop_ok);
+
+/* Call when a sample has been taken: closes the measurement period and
+ * passes it to the hook.
+ */
+void    LPM_Sampled(void);
+
+/* Called from LPM_Sampled in the main loop (NULL: none) */
+void    LPM_SetMeasureHook(LPM_MeasureHook hook);
+
+void    LPM_GetStats(LPM_Stats *stats);
+
+/* From LPTIM1_IRQHandler */
+void    LPM_IRQHandler(void);
+
+#endif /* INC_LOW_POWER_H_ */
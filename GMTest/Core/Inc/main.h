@@ -41,7 +41,11 @@ extern "C" {
 
 /* Exported constants --------------------------------------------------------*/
 /* USER CODE BEGIN EC */
-
+// Main loop scheduler events (sched.h), signalled from the IRQ handlers
+#define EVT_ADC_BLOCK	(1U << 0)	// DMA1 ch1: an ADC block is in the ring
+#define EVT_SPOT_DUE	(1U << 1)	// LPTIM1: time for a spot reading
+#define EVT_USB			(1U << 2)	// OTG_FS: USB transfer done or command in
+#define EVT_DISPLAY		(1U << 3)	// readings waiting to be drawn
 /* USER CODE END EC */
 
 /* Exported macro ------------------------------------------------------------*/
@@ -50,6 +54,8 @@ extern "C" {
 /* USER CODE END EM */
 
 /* Exported functions prototypes ---------------------------------------------*/
+void HAL_TIM_MspPostInit(TIM_HandleTypeDef *htim);
+
 void Error_Handler(void);
 
 /* USER CODE BEGIN EFP */
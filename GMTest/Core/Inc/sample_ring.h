@@ -0,0 +1,61 @@
+/*
+ * sample_ring.h
+ *
+ *  Created on: Oct 17, 2026
+ *      Author: kings
+ */
+
+#ifndef INC_SAMPLE_RING_H_
+#define INC_SAMPLE_RING_H_
+
+#include <stdint.h>
+
+/* Single-producer / single-consumer ring of timestamped samples. The
+ * producer (an IRQ) only writes head, the consumer (the main loop) only
+ * writes tail, so neither side needs to mask interrupts. Both indices run
+ * freely and are masked on access; the length must be a power of two.
+ *
+ * A full ring drops the new sample (the consumer may be reading the
+ * oldest one) and flags the next sample that does get in with
+ * SRING_FLAG_GAP.
+ */
+
+#define SRING_FLAG_GAP      0x0001U // samples before this one were lost
+#define SRING_FLAG_OVERRUN  0x0002U // ADC overrun just before this sample
+#define SRING_FLAG_CLIP     0x0004U // raw value at either end of the range
+
+typedef struct {
+    uint32_t tick;      // HAL_GetTick() time of the conversion, ms
+    uint16_t raw;       // sample, 16-bit full scale
+    uint16_t flags;     // SRING_FLAG_x
+} SRING_Sample;
+
+typedef struct {
+    uint32_t pushed;    // samples accepted
+    uint32_t dropped;   // samples lost because the ring was full
+    uint32_t high_water;// most samples ever waiting
+} SRING_Stats;
+
+typedef struct {
+    SRING_Sample *buf;
+    uint32_t mask;
+    volatile uint32_t head;     // written by the producer only
+    volatile uint32_t tail;     // written by the consumer only
+    uint16_t pending_flags;     // producer side, ORed into the next sample
+    SRING_Stats stats;          // producer side
+} SRING_Ring;
+
+/* Neither side may be running during init */
+void     SRING_Init(SRING_Ring *r, SRING_Sample *buf, uint32_t len);
+
+/* Producer side */
+uint8_t  SRING_Push(SRING_Ring *r, uint32_t tick, uint16_t raw, uint16_t flags);
+void     SRING_MarkNext(SRING_Ring *r, uint16_t flags);
+
+/* Consumer side */
+uint8_t  SRING_Pop(SRING_Ring *r, SRING_Sample *s);
+uint32_t SRING_Read(SRING_Ring *r, SRING_Sample *out, uint32_t max);
+uint32_t SRING_Count(const SRING_Ring *r);
+void     SRING_GetStats(const SRING_Ring *r, SRING_Stats *stats);
+
+#endif /* INC_SAMPLE_RING_H_ */
@@ -0,0 +1,75 @@
+/*
+ * sched.h
+ *
+ *  Created on: Oct 17, 2026
+ *      Author: kings
+ */
+
+#ifndef INC_SCHED_H_
+#define INC_SCHED_H_
+
+#include <stdint.h>
+
+/* Cooperative run-to-completion scheduler for the main loop. Tasks are
+ * plain functions in a fixed table; none of them blocks, and none is
+ * preempted by another, only by interrupts.
+ *
+ * A task is released by its period, by any of its event bits (set with
+ * SCHED_Signal, from an IRQ or a task) or both. SCHED_RunOne runs the
+ * released task with the highest priority, earliest deadline first among
+ * equals, then returns, so a task released meanwhile waits at most for
+ * the one task already running. Long work belongs in a low-priority task.
+ *
+ * Each run is timed: DWT cycles for the execution time, HAL_GetTick for
+ * latency and response (release to start and to finish). A run that
+ * finishes later than deadline_ms after its release is a miss. A periodic
+ * task still waiting when its next period comes keeps one release and
+ * counts the others as skipped, rather than running several times to
+ * catch up.
+ */
+#define SCHED_MAX_TASKS     8U
+
+typedef void (*SCHED_TaskFn)(uint32_t events);
+
+typedef struct {
+    const char  *name;
+    SCHED_TaskFn fn;            // gets the event bits that released it
+    uint8_t      priority;      // 0 runs first
+    uint32_t     events;        // bits that release it, 0: none
+    uint32_t     period_ms;     // 0: events only
+    uint32_t     deadline_ms;   // release to finish, 0: none
+} SCHED_Task;
+
+typedef struct {
+    uint32_t runs;
+    uint32_t misses;            // finished past the deadline
+    uint32_t skipped;           // periods that fell on a pending release
+    uint32_t last_cycles;
+    uint32_t wcet_cycles;       // longest run
+    uint32_t max_latency_ms;    // release to start
+    uint32_t max_response_ms;   // release to finish
+} SCHED_Stats;
+
+/* Clears the table; tasks added later start their period from then */
+void     SCHED_Init(void);
+
+/* The task must stay valid (static const). Returns its id, -1 if the
+ * table is full.
+ */
+int8_t   SCHED_Add(const SCHED_Task *task);
+
+/* Any context */
+void     SCHED_Signal(uint32_t events);
+
+/* Runs one released task. Returns 0 if none was. */
+uint8_t  SCHED_RunOne(void);
+
+/* Returns 1 if SCHED_RunOne would run something now. With interrupts
+ * disabled, the check before going to sleep.
+ */
+uint8_t  SCHED_Pending(void);
+
+const SCHED_Task *SCHED_GetTask(int8_t id);
+void     SCHED_GetStats(int8_t id, SCHED_Stats *stats);
+
+#endif /* INC_SCHED_H_ */
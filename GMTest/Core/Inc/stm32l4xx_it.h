@@ -55,10 +55,19 @@ void SVC_Handler(void);
 void DebugMon_Handler(void);
 void PendSV_Handler(void);
 void SysTick_Handler(void);
+void FLASH_IRQHandler(void);
+void DMA1_Channel1_IRQHandler(void);
+void DMA1_Channel3_IRQHandler(void);
 void ADC1_2_IRQHandler(void);
+void TIM1_UP_TIM16_IRQHandler(void);
 void TIM2_IRQHandler(void);
+void SPI1_IRQHandler(void);
+void UART4_IRQHandler(void);
+void DMA2_Channel3_IRQHandler(void);
 void OTG_FS_IRQHandler(void);
 /* USER CODE BEGIN EFP */
+void LPTIM1_IRQHandler(void);
+void EXTI9_5_IRQHandler(void);
 
 /* USER CODE END EFP */
 
@@ -0,0 +1,101 @@
+/*
+ * telemetry.h
+ *
+ *  Created on: Oct 17, 2026
+ *      Author: kings
+ */
+
+#ifndef INC_TELEMETRY_H_
+#define INC_TELEMETRY_H_
+
+#include <stdint.h>
+#include "sample_ring.h"
+
+/* Binary telemetry over the USB CDC port. Each frame is
+ *
+ *     COBS(payload, CRC-32 of payload LE) 0x00
+ *
+ * so a reader resynchronises on the next zero byte after any loss; the
+ * CRC is CSUM_Crc32. A payload starts with its type and a sequence number
+ * counting every frame sent or dropped, then the fields below, all little
+ * endian. Tools/tlm_decode.py decodes the stream on the host.
+ *
+ * Frames are packed back to back into one half of UserTxBufferFS while
+ * the other half is on the wire, so USB packets go out full (about 30
+ * samples per 64 bytes) and nothing waits for the host. With no host
+ * reading, frames are dropped and counted.
+ */
+#define TLM_TYPE_SAMPLES    0x01U
+#define TLM_TYPE_GLUCOSE    0x02U
+#define TLM_TYPE_ALARM      0x03U
+#define TLM_TYPE_EXPORT     0x10U   // log export header, see log_export.h
+#define TLM_TYPE_EXPORT_END 0x11U
+
+// USB VBUS sense: PA9 (OTG_FS_VBUS) as a plain input through the board's
+// divider, since the OTG core's own VBUS sensing is off (usbd_conf.c). The
+// pull-down reads a board without it as never attached.
+#define TLM_VBUS_GPIO_Port  GPIOA
+#define TLM_VBUS_Pin        GPIO_PIN_9
+
+#define TLM_MAX_PAYLOAD     250U    // payload + CRC fits one COBS block
+#define TLM_BATCH_MAX       ((TLM_MAX_PAYLOAD - 10U) / 2U)
+
+/* TLM_TYPE_SAMPLES: type, seq, count, flags (SRING_FLAG_x of the batch),
+ * tick of the first sample (u32, ms), tick of the last minus the first
+ * (u16, ms), then count raw samples (u16, 16-bit full scale). Samples are
+ * evenly spaced; a gap in the ring starts a new batch.
+ *
+ * TLM_TYPE_GLUCOSE: type, seq, tick (u32), glucose (s32, mg/dL Q16),
+ * filtered signal (u16), trend slope (s32, mg/dL/min Q16), trend valid
+ * (u8), block flags (u16).
+ *
+ * TLM_TYPE_ALARM: type, seq, tick (u32), Alarm_Kind (u8), Alarm_State (u8).
+ *
+ * TLM_TYPE_EXPORT: type, seq, length (u32); that many raw bytes follow the
+ * frame, then TLM_TYPE_EXPORT_END: type, seq, length (u32), CRC-32 of the
+ * raw bytes (u32).
+ */
+
+typedef struct {
+    uint32_t frames;        // frames queued
+    uint32_t dropped;       // frames lost: no host, paused or both halves busy
+    uint32_t bytes;         // encoded bytes queued
+    uint32_t transfers;     // buffer handoffs to the CDC class
+} TLM_Stats;
+
+void TLM_Init(void);
+
+/* Main loop side only; fits ACQ_SetSampleSink */
+void TLM_AddSample(const SRING_Sample *s);
+void TLM_SendGlucose(uint32_t tick, int32_t glucose, uint16_t filt16,
+                     int32_t slope, uint8_t slope_valid, uint16_t flags);
+void TLM_SendAlarm(uint32_t tick, uint8_t kind, uint8_t state);
+
+/* Hands the filled half to USB once the previous transfer is done. Call
+ * every main loop pass.
+ */
+void TLM_Poll(void);
+void TLM_GetStats(TLM_Stats *stats);
+
+/* Returns 1 while a host has the CDC interface configured */
+uint8_t TLM_Connected(void);
+
+/* Returns 1 while VBUS is present, from the plug going in, before the
+ * host has enumerated the device. The pin edge interrupt (EXTI9_5) wakes
+ * the core, from Stop2 too, so the host finds the clocks running.
+ */
+uint8_t TLM_VbusPresent(void);
+
+/* Stops sending and drops everything queued or sent until resumed, so
+ * another user can have the CDC IN endpoint and UserTxBufferFS. A transfer
+ * already handed to the class still completes.
+ */
+void TLM_Pause(uint8_t on);
+
+/* Frames a payload (type in byte 0, 4 spare bytes past len) with the next
+ * sequence number into out, which needs len + 6 bytes. Returns the bytes
+ * written, delimiter included.
+ */
+uint32_t TLM_EncodeFrame(uint8_t *payload, uint32_t len, uint8_t *out);
+
+#endif /* INC_TELEMETRY_H_ */
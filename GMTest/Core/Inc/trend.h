@@ -0,0 +1,54 @@
+/*
+ * trend.h
+ *
+ *  Created on: Oct 17, 2026
+ *      Author: kings
+ */
+
+#ifndef INC_TREND_H_
+#define INC_TREND_H_
+
+#include <stdint.h>
+
+/* Rate of change of the glucose reading. Samples are averaged into one
+ * point per TREND_POINT_MS, and a least-squares line is kept over the last
+ * TREND_WINDOW points with running sums: adding a point updates the fit in
+ * constant time, nothing rescans the history.
+ *
+ * TREND_Predict() extends the line to lower/upper limits so an alarm can
+ * fire before a limit is actually crossed.
+ */
+#define TREND_POINT_MS      5000U   // one regression point per 5 s
+#define TREND_WINDOW        60U     // points in the fit (5 min)
+#define TREND_MIN_POINTS    12U     // a minute of data before a slope
+#define TREND_HORIZON_S     1200U   // predictions further out are ignored
+
+typedef struct {
+    uint8_t  valid;     // enough points for a slope
+    uint16_t points;    // points in the fit
+    int32_t  level;     // fitted value at the newest point, mg/dL Q16
+    int32_t  slope;     // mg/dL per minute, Q16
+} TREND_Estimate;
+
+typedef enum {
+    TREND_LIMIT_NONE = 0,
+    TREND_LIMIT_LOW,
+    TREND_LIMIT_HIGH,
+} TREND_Limit;
+
+void    TREND_Init(void);
+
+/* One value (mg/dL Q16) at tick ms. Returns 1 when it closed a point and
+ * the estimate changed. A point closes on the first value TREND_POINT_MS or
+ * more after its own first, so values one a point apart need ticks on that
+ * cadence, not wandering a millisecond either side of it.
+ */
+uint8_t TREND_AddSample(uint32_t tick, int32_t value);
+void    TREND_Get(TREND_Estimate *est);
+
+/* Which limit the fitted line reaches within TREND_HORIZON_S, and in how
+ * many seconds (0: already past it). Limits are mg/dL Q16.
+ */
+TREND_Limit TREND_Predict(int32_t lower, int32_t upper, uint32_t *seconds);
+
+#endif /* INC_TREND_H_ */
@@ -0,0 +1,56 @@
+/*
+ * uart_log.h
+ *
+ *  Created on: Oct 17, 2026
+ *      Author: kings
+ */
+
+#ifndef INC_UART_LOG_H_
+#define INC_UART_LOG_H_
+
+#include <stdint.h>
+
+/* Buffered log output on UART4 (the PC debug port). Writers copy into a
+ * byte ring and return at once; UART4 TX DMA drains the ring in the
+ * background, one contiguous chunk per transfer, and the completion
+ * interrupt starts the next one.
+ *
+ * Any context may write, including interrupts that preempt another
+ * writer: space is reserved with LDREX/STREX and the bytes are released
+ * to the DMA when the outermost writer finishes, so nothing ever masks
+ * interrupts or waits for the UART. A write that does not fit is dropped
+ * whole and counted, so lines never come out torn.
+ *
+ * printf ends up here through _write, but newlib's printf is not
+ * reentrant; from an interrupt use ULOG_Write.
+ */
+#ifndef ULOG_BUF_LEN
+#define ULOG_BUF_LEN        2048U   // power of two
+#endif
+
+typedef struct {
+    uint32_t written;       // bytes accepted
+    uint32_t dropped;       // bytes lost because the ring was full
+    uint32_t high_water;    // most bytes ever waiting
+    uint32_t transfers;     // DMA transfers started
+} ULOG_Stats;
+
+/* Call once UART4 is initialised. Anything written before is kept and
+ * sent then.
+ */
+void     ULOG_Init(void);
+
+/* Returns len, or 0 if the bytes were dropped */
+uint32_t ULOG_Write(const void *data, uint32_t len);
+
+/* Blocks until the ring is empty or timeout_ms runs out; for use before a
+ * reset or anything else that would cut the output short.
+ */
+uint8_t  ULOG_Flush(uint32_t timeout_ms);
+
+/* Returns 1 while bytes are waiting or a transfer is in flight */
+uint8_t  ULOG_Busy(void);
+
+void     ULOG_GetStats(ULOG_Stats *stats);
+
+#endif /* INC_UART_LOG_H_ */
@@ -0,0 +1,841 @@
+/*
+ * GFX_Digits.c
+ *
+ *  Generated by Tools/gen_digits.py - do not edit by hand.
+ */
+
+#include "GFX_Digits.h"
+
+static const uint8_t digits_24x32[10 * 384] = {
+    /* '0' */
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x03,0x30,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x18,0xEF,0xFE,0x81,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x03,0xDF,0xFF,0xFF,0xFD,0x30,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x1D,0xFF,0xFF,0xFF,0xFF,0xD1,0x00,0x00,0x00,
+    0x00,0x00,0x00,0xAF,0xFF,0xE8,0x8E,0xFF,0xFA,0x00,0x00,0x00,
+    0x00,0x00,0x04,0xFF,0xFE,0x30,0x03,0xEF,0xFF,0x40,0x00,0x00,
+    0x00,0x00,0x0B,0xFF,0xF5,0x00,0x00,0x5F,0xFF,0xB0,0x00,0x00,
+    0x00,0x00,0x2F,0xFF,0xB0,0x00,0x00,0x0B,0xFF,0xF2,0x00,0x00,
+    0x00,0x00,0x7F,0xFF,0x60,0x00,0x00,0x06,0xFF,0xF7,0x00,0x00,
+    0x00,0x00,0xBF,0xFF,0x00,0x00,0x00,0x00,0xFF,0xFB,0x00,0x00,
+    0x00,0x00,0xEF,0xFB,0x00,0x00,0x00,0x00,0xBF,0xFE,0x00,0x00,
+    0x00,0x02,0xFF,0xF8,0x00,0x00,0x00,0x00,0x8F,0xFF,0x20,0x00,
+    0x00,0x04,0xFF,0xF7,0x00,0x00,0x00,0x00,0x7F,0xFF,0x40,0x00,
+    0x00,0x04,0xFF,0xF4,0x00,0x00,0x00,0x00,0x4F,0xFF,0x40,0x00,
+    0x00,0x04,0xFF,0xF4,0x00,0x00,0x00,0x00,0x4F,0xFF,0x40,0x00,
+    0x00,0x04,0xFF,0xF4,0x00,0x00,0x00,0x00,0x4F,0xFF,0x40,0x00,
+    0x00,0x04,0xFF,0xF4,0x00,0x00,0x00,0x00,0x4F,0xFF,0x40,0x00,
+    0x00,0x04,0xFF,0xF7,0x00,0x00,0x00,0x00,0x7F,0xFF,0x40,0x00,
+    0x00,0x02,0xFF,0xF8,0x00,0x00,0x00,0x00,0x8F,0xFF,0x20,0x00,
+    0x00,0x00,0xEF,0xFB,0x00,0x00,0x00,0x00,0xBF,0xFE,0x00,0x00,
+    0x00,0x00,0xBF,0xFF,0x00,0x00,0x00,0x00,0xFF,0xFB,0x00,0x00,
+    0x00,0x00,0x7F,0xFF,0x60,0x00,0x00,0x06,0xFF,0xF7,0x00,0x00,
+    0x00,0x00,0x2F,0xFF,0xB0,0x00,0x00,0x0B,0xFF,0xF2,0x00,0x00,
+    0x00,0x00,0x0B,0xFF,0xF5,0x00,0x00,0x5F,0xFF,0xB0,0x00,0x00,
+    0x00,0x00,0x04,0xFF,0xFE,0x30,0x03,0xEF,0xFF,0x40,0x00,0x00,
+    0x00,0x00,0x00,0xAF,0xFF,0xE8,0x8E,0xFF,0xFA,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x1D,0xFF,0xFF,0xFF,0xFF,0xD1,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x03,0xDF,0xFF,0xFF,0xFD,0x30,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x18,0xEF,0xFE,0x81,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x03,0x30,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    /* '1' */
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x30,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x3E,0xFB,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x03,0xEF,0xFF,0x30,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x6F,0xFF,0xFF,0x40,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x06,0xFF,0xFF,0xFF,0x40,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x6F,0xFF,0xFF,0xFF,0x40,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0xBF,0xFF,0xEF,0xFF,0x40,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x8F,0xF9,0x8F,0xFF,0x40,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x04,0x30,0x8F,0xFF,0x40,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x8F,0xFF,0x40,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x8F,0xFF,0x40,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x8F,0xFF,0x40,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x8F,0xFF,0x40,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x8F,0xFF,0x40,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x8F,0xFF,0x40,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x8F,0xFF,0x40,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x8F,0xFF,0x40,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x8F,0xFF,0x40,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x8F,0xFF,0x40,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x8F,0xFF,0x40,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x8F,0xFF,0x40,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x8F,0xFF,0x40,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x8F,0xFF,0x40,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x8F,0xFF,0x40,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x8F,0xFF,0x40,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x05,0x88,0xBF,0xFF,0x98,0x83,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x8F,0xFF,0xFF,0xFF,0xFF,0xFF,0x40,0x00,0x00,
+    0x00,0x00,0x00,0xBF,0xFF,0xFF,0xFF,0xFF,0xFF,0x80,0x00,0x00,
+    0x00,0x00,0x00,0x6F,0xFF,0xFF,0xFF,0xFF,0xFE,0x30,0x00,0x00,
+    0x00,0x00,0x00,0x02,0x44,0x44,0x44,0x44,0x41,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    /* '2' */
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x04,0x40,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x4A,0xFF,0xFF,0xA4,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x09,0xFF,0xFF,0xFF,0xFF,0x90,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x9F,0xFF,0xFF,0xFF,0xFF,0xF9,0x00,0x00,0x00,
+    0x00,0x00,0x07,0xFF,0xFF,0xB8,0x8B,0xFF,0xFF,0x70,0x00,0x00,
+    0x00,0x00,0x1E,0xFF,0xF6,0x00,0x00,0x6F,0xFF,0xE1,0x00,0x00,
+    0x00,0x00,0x6F,0xFF,0x80,0x00,0x00,0x08,0xFF,0xF6,0x00,0x00,
+    0x00,0x00,0x6F,0xFF,0x20,0x00,0x00,0x02,0xFF,0xF9,0x00,0x00,
+    0x00,0x00,0x09,0xB6,0x00,0x00,0x00,0x00,0xCF,0xFB,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xBF,0xFB,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xDF,0xFB,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x04,0xFF,0xF8,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x2E,0xFF,0xF5,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xCF,0xFF,0xB0,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x09,0xFF,0xFD,0x10,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x6F,0xFF,0xF3,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x03,0xEF,0xFF,0x60,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x1D,0xFF,0xF9,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0xBF,0xFF,0xC1,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x08,0xFF,0xFE,0x20,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x5F,0xFF,0xF5,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x02,0xEF,0xFF,0x80,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x1C,0xFF,0xFA,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x9F,0xFF,0xD1,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x06,0xFF,0xFE,0x30,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x3F,0xFF,0xFC,0x88,0x88,0x88,0x88,0x83,0x00,0x00,
+    0x00,0x00,0xDF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x50,0x00,
+    0x00,0x03,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x80,0x00,
+    0x00,0x00,0xCF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFE,0x30,0x00,
+    0x00,0x00,0x03,0x44,0x44,0x44,0x44,0x44,0x44,0x41,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    /* '3' */
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x04,0x40,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x4A,0xFF,0xFF,0xA4,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x08,0xFF,0xFF,0xFF,0xFF,0x80,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x8F,0xFF,0xFF,0xFF,0xFF,0xF8,0x00,0x00,0x00,
+    0x00,0x00,0x04,0xFF,0xFF,0xB8,0x8B,0xFF,0xFF,0x40,0x00,0x00,
+    0x00,0x00,0x0A,0xFF,0xF8,0x00,0x00,0x8F,0xFF,0xB0,0x00,0x00,
+    0x00,0x00,0x08,0xFF,0xB0,0x00,0x00,0x0B,0xFF,0xF2,0x00,0x00,
+    0x00,0x00,0x00,0x67,0x10,0x00,0x00,0x05,0xFF,0xF5,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x04,0xFF,0xF8,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x04,0xFF,0xF8,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x07,0xFF,0xF4,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x1E,0xFF,0xF1,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x02,0xCF,0xFF,0x90,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x3A,0xCF,0xFF,0xFE,0x10,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0xAF,0xFF,0xFF,0xF3,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0xAF,0xFF,0xFF,0xF9,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x3A,0xCF,0xFF,0xFF,0x90,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x01,0x8F,0xFF,0xF4,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x06,0xFF,0xFA,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xCF,0xFF,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x8F,0xFF,0x30,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x8F,0xFF,0x40,0x00,
+    0x00,0x00,0x04,0x83,0x00,0x00,0x00,0x00,0x9F,0xFF,0x00,0x00,
+    0x00,0x00,0x2F,0xFE,0x20,0x00,0x00,0x02,0xFF,0xFC,0x00,0x00,
+    0x00,0x00,0x4F,0xFF,0xC3,0x00,0x00,0x3C,0xFF,0xF7,0x00,0x00,
+    0x00,0x00,0x0D,0xFF,0xFF,0x98,0x89,0xFF,0xFF,0xD0,0x00,0x00,
+    0x00,0x00,0x03,0xEF,0xFF,0xFF,0xFF,0xFF,0xFE,0x30,0x00,0x00,
+    0x00,0x00,0x00,0x3C,0xFF,0xFF,0xFF,0xFF,0xC3,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x6C,0xFF,0xFF,0xC6,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x04,0x40,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    /* '4' */
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x22,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x07,0xFF,0x50,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x2E,0xFF,0xB0,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x9F,0xFF,0xB0,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x04,0xFF,0xFF,0xB0,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x0B,0xFF,0xFF,0xB0,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x6F,0xFF,0xFF,0xB0,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0xDF,0xFF,0xFF,0xB0,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x08,0xFF,0xFF,0xFF,0xB0,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x1E,0xFF,0xFF,0xFF,0xB0,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x9F,0xFF,0x8F,0xFF,0xB0,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x03,0xFF,0xFE,0x1F,0xFF,0xB0,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x0B,0xFF,0xF6,0x0F,0xFF,0xB0,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x4F,0xFF,0xD0,0x0F,0xFF,0xB0,0x00,0x00,0x00,
+    0x00,0x00,0x00,0xDF,0xFF,0x40,0x0F,0xFF,0xB0,0x00,0x00,0x00,
+    0x00,0x00,0x07,0xFF,0xFB,0x00,0x0F,0xFF,0xB0,0x00,0x00,0x00,
+    0x00,0x00,0x1E,0xFF,0xF2,0x00,0x0F,0xFF,0xB0,0x00,0x00,0x00,
+    0x00,0x00,0x8F,0xFF,0x80,0x00,0x0F,0xFF,0xB0,0x00,0x00,0x00,
+    0x00,0x02,0xFF,0xFF,0xCB,0xBB,0xBF,0xFF,0xEB,0xBB,0x40,0x00,
+    0x00,0x09,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xE0,0x00,
+    0x00,0x0A,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xF0,0x00,
+    0x00,0x03,0xAB,0xBB,0xBB,0xBB,0xBF,0xFF,0xEB,0xBB,0x60,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x0F,0xFF,0xB0,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x0F,0xFF,0xB0,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x0F,0xFF,0xB0,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x0F,0xFF,0xB0,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x0F,0xFF,0xB0,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x0D,0xFF,0xB0,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x07,0xFF,0x50,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x22,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    /* '5' */
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x14,0x44,0x44,0x44,0x44,0x44,0x10,0x00,0x00,
+    0x00,0x00,0x03,0xEF,0xFF,0xFF,0xFF,0xFF,0xFF,0xE4,0x00,0x00,
+    0x00,0x00,0x08,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xF8,0x00,0x00,
+    0x00,0x00,0x08,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xF5,0x00,0x00,
+    0x00,0x00,0x0B,0xFF,0xF8,0x88,0x88,0x88,0x88,0x40,0x00,0x00,
+    0x00,0x00,0x0B,0xFF,0xD0,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x0B,0xFF,0xB0,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x0C,0xFF,0xB0,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x0F,0xFF,0xB0,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x0F,0xFF,0x90,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x0F,0xFF,0x82,0x78,0x87,0x20,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x1F,0xFF,0xEF,0xFF,0xFF,0xFB,0x20,0x00,0x00,0x00,
+    0x00,0x00,0x4F,0xFF,0xFF,0xFF,0xFF,0xFF,0xE3,0x00,0x00,0x00,
+    0x00,0x00,0x4F,0xFF,0xFF,0xFF,0xFF,0xFF,0xFE,0x20,0x00,0x00,
+    0x00,0x00,0x3F,0xFF,0xFD,0x50,0x06,0xDF,0xFF,0xB0,0x00,0x00,
+    0x00,0x00,0x08,0xFF,0xC1,0x00,0x00,0x1D,0xFF,0xF4,0x00,0x00,
+    0x00,0x00,0x00,0x04,0x00,0x00,0x00,0x04,0xFF,0xFA,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xCF,0xFE,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x8F,0xFF,0x10,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x8F,0xFF,0x40,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x8F,0xFF,0x40,0x00,
+    0x00,0x00,0x00,0x40,0x00,0x00,0x00,0x00,0x9F,0xFF,0x00,0x00,
+    0x00,0x00,0x1C,0xFC,0x10,0x00,0x00,0x01,0xEF,0xFC,0x00,0x00,
+    0x00,0x00,0x4F,0xFF,0x80,0x00,0x00,0x08,0xFF,0xF8,0x00,0x00,
+    0x00,0x00,0x2F,0xFF,0xF6,0x00,0x00,0x6F,0xFF,0xF2,0x00,0x00,
+    0x00,0x00,0x08,0xFF,0xFF,0xB8,0x8B,0xFF,0xFF,0x80,0x00,0x00,
+    0x00,0x00,0x00,0xAF,0xFF,0xFF,0xFF,0xFF,0xFA,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x09,0xFF,0xFF,0xFF,0xFF,0x90,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x4A,0xFF,0xFF,0xA4,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x04,0x40,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    /* '6' */
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x04,0xAD,0xEB,0x71,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x01,0xBF,0xFF,0xFF,0xFC,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x1D,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x01,0xCF,0xFF,0xFC,0xBE,0xFA,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x08,0xFF,0xFE,0x40,0x01,0x40,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x2F,0xFF,0xE3,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x9F,0xFF,0x70,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x02,0xFF,0xFD,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x07,0xFF,0xF6,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x0B,0xFF,0xF3,0x78,0x87,0x20,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x0F,0xFF,0xEF,0xFF,0xFF,0xF9,0x10,0x00,0x00,0x00,
+    0x00,0x00,0x4F,0xFF,0xFF,0xFF,0xFF,0xFF,0xC1,0x00,0x00,0x00,
+    0x00,0x00,0x7F,0xFF,0xFF,0xFF,0xFF,0xFF,0xFC,0x00,0x00,0x00,
+    0x00,0x00,0x8F,0xFF,0xFE,0x61,0x16,0xEF,0xFF,0x80,0x00,0x00,
+    0x00,0x00,0xBF,0xFF,0xF3,0x00,0x00,0x3F,0xFF,0xE0,0x00,0x00,
+    0x00,0x00,0xBF,0xFF,0x80,0x00,0x00,0x08,0xFF,0xF5,0x00,0x00,
+    0x00,0x00,0xBF,0xFF,0x20,0x00,0x00,0x02,0xFF,0xF8,0x00,0x00,
+    0x00,0x00,0xBF,0xFE,0x00,0x00,0x00,0x00,0xEF,0xFB,0x00,0x00,
+    0x00,0x00,0xBF,0xFB,0x00,0x00,0x00,0x00,0xBF,0xFB,0x00,0x00,
+    0x00,0x00,0xBF,0xFB,0x00,0x00,0x00,0x00,0xBF,0xFB,0x00,0x00,
+    0x00,0x00,0xAF,0xFF,0x00,0x00,0x00,0x00,0xFF,0xFA,0x00,0x00,
+    0x00,0x00,0x8F,0xFF,0x50,0x00,0x00,0x05,0xFF,0xF8,0x00,0x00,
+    0x00,0x00,0x3F,0xFF,0xB0,0x00,0x00,0x0B,0xFF,0xF3,0x00,0x00,
+    0x00,0x00,0x0B,0xFF,0xF9,0x00,0x00,0x9F,0xFF,0xB0,0x00,0x00,
+    0x00,0x00,0x04,0xFF,0xFF,0xD8,0x8D,0xFF,0xFF,0x40,0x00,0x00,
+    0x00,0x00,0x00,0x7F,0xFF,0xFF,0xFF,0xFF,0xF7,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x07,0xFF,0xFF,0xFF,0xFF,0x70,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x3A,0xFF,0xFF,0xA3,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x03,0x30,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    /* '7' */
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x24,0x44,0x44,0x44,0x44,0x44,0x44,0x42,0x00,0x00,
+    0x00,0x05,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x50,0x00,
+    0x00,0x0B,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xB0,0x00,
+    0x00,0x08,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x80,0x00,
+    0x00,0x00,0x58,0x88,0x88,0x88,0x88,0x88,0xDF,0xFF,0x30,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0xEF,0xFC,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x06,0xFF,0xF7,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x0A,0xFF,0xF2,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x1F,0xFF,0xC0,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x6F,0xFF,0x60,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xCF,0xFF,0x10,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x02,0xFF,0xFA,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x07,0xFF,0xF6,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x0C,0xFF,0xE1,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x3F,0xFF,0x90,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x8F,0xFF,0x50,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0xDF,0xFE,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x03,0xFF,0xF8,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x09,0xFF,0xF3,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x0E,0xFF,0xD0,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x5F,0xFF,0x80,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x9F,0xFF,0x20,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x01,0xEF,0xFC,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x06,0xFF,0xF7,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x0A,0xFF,0xF2,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x1F,0xFF,0xB0,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x6F,0xFF,0x60,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x8F,0xFF,0x10,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x4E,0xF8,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x01,0x30,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    /* '8' */
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x04,0x40,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x29,0xFF,0xFF,0x92,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x06,0xEF,0xFF,0xFF,0xFE,0x60,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x4F,0xFF,0xFF,0xFF,0xFF,0xF4,0x00,0x00,0x00,
+    0x00,0x00,0x00,0xDF,0xFF,0xD8,0x8D,0xFF,0xFD,0x00,0x00,0x00,
+    0x00,0x00,0x06,0xFF,0xFC,0x10,0x01,0xCF,0xFF,0x60,0x00,0x00,
+    0x00,0x00,0x0A,0xFF,0xF2,0x00,0x00,0x2F,0xFF,0xA0,0x00,0x00,
+    0x00,0x00,0x0B,0xFF,0xC0,0x00,0x00,0x0C,0xFF,0xB0,0x00,0x00,
+    0x00,0x00,0x0F,0xFF,0xB0,0x00,0x00,0x0B,0xFF,0xF0,0x00,0x00,
+    0x00,0x00,0x0C,0xFF,0xC0,0x00,0x00,0x0C,0xFF,0xC0,0x00,0x00,
+    0x00,0x00,0x0A,0xFF,0xF2,0x00,0x00,0x2F,0xFF,0xA0,0x00,0x00,
+    0x00,0x00,0x06,0xFF,0xFB,0x00,0x00,0xBF,0xFF,0x60,0x00,0x00,
+    0x00,0x00,0x00,0xDF,0xFF,0xC8,0x8C,0xFF,0xFD,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x4F,0xFF,0xFF,0xFF,0xFF,0xF4,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x3E,0xFF,0xFF,0xFF,0xFF,0xE3,0x00,0x00,0x00,
+    0x00,0x00,0x02,0xEF,0xFF,0xFF,0xFF,0xFF,0xFE,0x20,0x00,0x00,
+    0x00,0x00,0x0B,0xFF,0xFE,0x84,0x48,0xEF,0xFF,0xB0,0x00,0x00,
+    0x00,0x00,0x4F,0xFF,0xE3,0x00,0x00,0x3E,0xFF,0xF4,0x00,0x00,
+    0x00,0x00,0x9F,0xFF,0x40,0x00,0x00,0x04,0xFF,0xF9,0x00,0x00,
+    0x00,0x00,0xDF,0xFC,0x00,0x00,0x00,0x00,0xCF,0xFD,0x00,0x00,
+    0x00,0x00,0xFF,0xF9,0x00,0x00,0x00,0x00,0x9F,0xFF,0x00,0x00,
+    0x00,0x00,0xFF,0xFA,0x00,0x00,0x00,0x00,0xAF,0xFF,0x00,0x00,
+    0x00,0x00,0xCF,0xFD,0x00,0x00,0x00,0x00,0xDF,0xFC,0x00,0x00,
+    0x00,0x00,0x9F,0xFF,0x60,0x00,0x00,0x06,0xFF,0xF9,0x00,0x00,
+    0x00,0x00,0x3F,0xFF,0xE4,0x00,0x00,0x4E,0xFF,0xF3,0x00,0x00,
+    0x00,0x00,0x0A,0xFF,0xFF,0xA8,0x8A,0xFF,0xFF,0xA0,0x00,0x00,
+    0x00,0x00,0x01,0xCF,0xFF,0xFF,0xFF,0xFF,0xFC,0x10,0x00,0x00,
+    0x00,0x00,0x00,0x1B,0xFF,0xFF,0xFF,0xFF,0xB1,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x6C,0xFF,0xFF,0xC6,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x04,0x40,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    /* '9' */
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x03,0x30,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x3A,0xFF,0xFF,0xA3,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x07,0xFF,0xFF,0xFF,0xFF,0x70,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x7F,0xFF,0xFF,0xFF,0xFF,0xF7,0x00,0x00,0x00,
+    0x00,0x00,0x04,0xFF,0xFF,0xD8,0x8D,0xFF,0xFF,0x40,0x00,0x00,
+    0x00,0x00,0x0B,0xFF,0xF9,0x00,0x00,0x9F,0xFF,0xB0,0x00,0x00,
+    0x00,0x00,0x3F,0xFF,0xB0,0x00,0x00,0x0B,0xFF,0xF3,0x00,0x00,
+    0x00,0x00,0x8F,0xFF,0x50,0x00,0x00,0x05,0xFF,0xF8,0x00,0x00,
+    0x00,0x00,0xAF,0xFF,0x00,0x00,0x00,0x00,0xFF,0xFA,0x00,0x00,
+    0x00,0x00,0xBF,0xFB,0x00,0x00,0x00,0x00,0xBF,0xFB,0x00,0x00,
+    0x00,0x00,0xBF,0xFB,0x00,0x00,0x00,0x00,0xBF,0xFB,0x00,0x00,
+    0x00,0x00,0xBF,0xFE,0x00,0x00,0x00,0x00,0xEF,0xFB,0x00,0x00,
+    0x00,0x00,0x8F,0xFF,0x20,0x00,0x00,0x02,0xFF,0xFB,0x00,0x00,
+    0x00,0x00,0x5F,0xFF,0x80,0x00,0x00,0x08,0xFF,0xFB,0x00,0x00,
+    0x00,0x00,0x0E,0xFF,0xF3,0x00,0x00,0x3F,0xFF,0xFB,0x00,0x00,
+    0x00,0x00,0x08,0xFF,0xFE,0x61,0x16,0xEF,0xFF,0xF8,0x00,0x00,
+    0x00,0x00,0x00,0xCF,0xFF,0xFF,0xFF,0xFF,0xFF,0xF7,0x00,0x00,
+    0x00,0x00,0x00,0x1C,0xFF,0xFF,0xFF,0xFF,0xFF,0xF4,0x00,0x00,
+    0x00,0x00,0x00,0x01,0x9F,0xFF,0xFF,0xFE,0xFF,0xF0,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x02,0x78,0x87,0x3F,0xFF,0xB0,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x6F,0xFF,0x70,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xDF,0xFF,0x20,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x07,0xFF,0xF9,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x3E,0xFF,0xF2,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x04,0x10,0x04,0xEF,0xFF,0x80,0x00,0x00,0x00,
+    0x00,0x00,0x00,0xAF,0xEB,0xCF,0xFF,0xFC,0x10,0x00,0x00,0x00,
+    0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xD1,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0xCF,0xFF,0xFF,0xFB,0x10,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x17,0xBE,0xDA,0x40,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+};
+
+const GFX_DigitFont GFX_Digits24x32 = {
+    24, 32, 384, digits_24x32
+};
+
+static const uint8_t digits_32x48[10 * 768] = {
+    /* '0' */
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x17,0xBF,0xFB,0x71,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x05,0xEF,0xFF,0xFF,0xFE,0x50,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x6F,0xFF,0xFF,0xFF,0xFF,0xF6,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x05,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x50,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x1E,0xFF,0xFF,0xFE,0xEF,0xFF,0xFF,0xE1,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x9F,0xFF,0xFF,0x70,0x07,0xFF,0xFF,0xF9,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x03,0xFF,0xFF,0xF7,0x00,0x00,0x7F,0xFF,0xFF,0x30,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x09,0xFF,0xFF,0xB0,0x00,0x00,0x0B,0xFF,0xFF,0x90,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x1F,0xFF,0xFF,0x30,0x00,0x00,0x03,0xFF,0xFF,0xF1,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x6F,0xFF,0xFB,0x00,0x00,0x00,0x00,0xBF,0xFF,0xF6,0x00,0x00,0x00,
+    0x00,0x00,0x00,0xAF,0xFF,0xF5,0x00,0x00,0x00,0x00,0x5F,0xFF,0xFA,0x00,0x00,0x00,
+    0x00,0x00,0x00,0xFF,0xFF,0xF0,0x00,0x00,0x00,0x00,0x0F,0xFF,0xFF,0x00,0x00,0x00,
+    0x00,0x00,0x04,0xFF,0xFF,0xA0,0x00,0x00,0x00,0x00,0x0A,0xFF,0xFF,0x40,0x00,0x00,
+    0x00,0x00,0x08,0xFF,0xFF,0x80,0x00,0x00,0x00,0x00,0x08,0xFF,0xFF,0x80,0x00,0x00,
+    0x00,0x00,0x09,0xFF,0xFF,0x40,0x00,0x00,0x00,0x00,0x04,0xFF,0xFF,0x90,0x00,0x00,
+    0x00,0x00,0x0B,0xFF,0xFF,0x10,0x00,0x00,0x00,0x00,0x01,0xFF,0xFF,0xB0,0x00,0x00,
+    0x00,0x00,0x0E,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xE0,0x00,0x00,
+    0x00,0x00,0x0F,0xFF,0xFB,0x00,0x00,0x00,0x00,0x00,0x00,0xBF,0xFF,0xF0,0x00,0x00,
+    0x00,0x00,0x0F,0xFF,0xFB,0x00,0x00,0x00,0x00,0x00,0x00,0xBF,0xFF,0xF0,0x00,0x00,
+    0x00,0x00,0x0F,0xFF,0xFB,0x00,0x00,0x00,0x00,0x00,0x00,0xBF,0xFF,0xF0,0x00,0x00,
+    0x00,0x00,0x4F,0xFF,0xFB,0x00,0x00,0x00,0x00,0x00,0x00,0xBF,0xFF,0xF4,0x00,0x00,
+    0x00,0x00,0x4F,0xFF,0xFB,0x00,0x00,0x00,0x00,0x00,0x00,0xBF,0xFF,0xF4,0x00,0x00,
+    0x00,0x00,0x0F,0xFF,0xFB,0x00,0x00,0x00,0x00,0x00,0x00,0xBF,0xFF,0xF0,0x00,0x00,
+    0x00,0x00,0x0F,0xFF,0xFB,0x00,0x00,0x00,0x00,0x00,0x00,0xBF,0xFF,0xF0,0x00,0x00,
+    0x00,0x00,0x0F,0xFF,0xFB,0x00,0x00,0x00,0x00,0x00,0x00,0xBF,0xFF,0xF0,0x00,0x00,
+    0x00,0x00,0x0E,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xE0,0x00,0x00,
+    0x00,0x00,0x0B,0xFF,0xFF,0x10,0x00,0x00,0x00,0x00,0x01,0xFF,0xFF,0xB0,0x00,0x00,
+    0x00,0x00,0x09,0xFF,0xFF,0x40,0x00,0x00,0x00,0x00,0x04,0xFF,0xFF,0x90,0x00,0x00,
+    0x00,0x00,0x08,0xFF,0xFF,0x80,0x00,0x00,0x00,0x00,0x08,0xFF,0xFF,0x80,0x00,0x00,
+    0x00,0x00,0x04,0xFF,0xFF,0xA0,0x00,0x00,0x00,0x00,0x0A,0xFF,0xFF,0x40,0x00,0x00,
+    0x00,0x00,0x00,0xFF,0xFF,0xF0,0x00,0x00,0x00,0x00,0x0F,0xFF,0xFF,0x00,0x00,0x00,
+    0x00,0x00,0x00,0xAF,0xFF,0xF5,0x00,0x00,0x00,0x00,0x5F,0xFF,0xFA,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x6F,0xFF,0xFB,0x00,0x00,0x00,0x00,0xBF,0xFF,0xF6,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x1F,0xFF,0xFF,0x30,0x00,0x00,0x03,0xFF,0xFF,0xF1,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x09,0xFF,0xFF,0xB0,0x00,0x00,0x0B,0xFF,0xFF,0x90,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x03,0xFF,0xFF,0xF7,0x00,0x00,0x7F,0xFF,0xFF,0x30,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x9F,0xFF,0xFF,0x70,0x07,0xFF,0xFF,0xF9,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x1E,0xFF,0xFF,0xFE,0xEF,0xFF,0xFF,0xE1,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x05,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x50,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x6F,0xFF,0xFF,0xFF,0xFF,0xF6,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x05,0xEF,0xFF,0xFF,0xFE,0x50,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x17,0xBF,0xFB,0x71,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    /* '1' */
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x1B,0xFB,0x10,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x01,0xCF,0xFF,0xA0,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x1C,0xFF,0xFF,0xE0,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x01,0xCF,0xFF,0xFF,0xF0,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x1C,0xFF,0xFF,0xFF,0xF0,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x01,0xCF,0xFF,0xFF,0xFF,0xF0,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x1C,0xFF,0xFF,0xFF,0xFF,0xF0,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x9F,0xFF,0xFF,0xFF,0xFF,0xF0,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0xBF,0xFF,0xFC,0xFF,0xFF,0xF0,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x6F,0xFF,0xC1,0xFF,0xFF,0xF0,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x06,0xB8,0x10,0xFF,0xFF,0xF0,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xF0,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xF0,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xF0,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xF0,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xF0,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xF0,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xF0,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xF0,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xF0,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xF0,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xF0,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xF0,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xF0,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xF0,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xF0,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xF0,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xF0,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xF0,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xF0,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xF0,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xF0,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xF0,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xF0,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xF0,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xF0,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xF0,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x08,0xBB,0xBB,0xFF,0xFF,0xFB,0xBB,0xB8,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x8F,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x70,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0xBF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xB0,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x8F,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x80,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x19,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xF9,0x10,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    /* '2' */
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x49,0xCF,0xFD,0x94,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x3B,0xFF,0xFF,0xFF,0xFF,0xB2,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x05,0xEF,0xFF,0xFF,0xFF,0xFF,0xFE,0x50,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x3F,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xF3,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x01,0xEF,0xFF,0xFF,0xFC,0xCF,0xFF,0xFF,0xFE,0x10,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x09,0xFF,0xFF,0xFA,0x20,0x02,0xAF,0xFF,0xFF,0x90,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x2F,0xFF,0xFF,0x90,0x00,0x00,0x09,0xFF,0xFF,0xF2,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x8F,0xFF,0xFB,0x00,0x00,0x00,0x00,0xBF,0xFF,0xF8,0x00,0x00,0x00,
+    0x00,0x00,0x00,0xDF,0xFF,0xF4,0x00,0x00,0x00,0x00,0x4F,0xFF,0xFD,0x00,0x00,0x00,
+    0x00,0x00,0x00,0xEF,0xFF,0xD0,0x00,0x00,0x00,0x00,0x0D,0xFF,0xFF,0x20,0x00,0x00,
+    0x00,0x00,0x00,0x8F,0xFF,0x50,0x00,0x00,0x00,0x00,0x08,0xFF,0xFF,0x40,0x00,0x00,
+    0x00,0x00,0x00,0x04,0x84,0x00,0x00,0x00,0x00,0x00,0x08,0xFF,0xFF,0x70,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x08,0xFF,0xFF,0x80,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x08,0xFF,0xFF,0x70,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x08,0xFF,0xFF,0x40,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x0C,0xFF,0xFF,0x20,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x7F,0xFF,0xFD,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x02,0xEF,0xFF,0xF8,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x0C,0xFF,0xFF,0xE2,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x8F,0xFF,0xFF,0x50,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x03,0xFF,0xFF,0xFA,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x1C,0xFF,0xFF,0xD1,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x8F,0xFF,0xFF,0x40,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x04,0xFF,0xFF,0xF8,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x1E,0xFF,0xFF,0xC1,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xAF,0xFF,0xFF,0x30,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x05,0xFF,0xFF,0xF8,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x2E,0xFF,0xFF,0xC0,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0xBF,0xFF,0xFE,0x20,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x07,0xFF,0xFF,0xF7,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x3E,0xFF,0xFF,0xB0,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0xCF,0xFF,0xFE,0x10,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x08,0xFF,0xFF,0xF5,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x3F,0xFF,0xFF,0x90,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x01,0xDF,0xFF,0xFD,0x10,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x08,0xFF,0xFF,0xF4,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x5F,0xFF,0xFF,0x80,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x01,0xEF,0xFF,0xFF,0xBB,0xBB,0xBB,0xBB,0xBB,0xBB,0xBB,0x50,0x00,0x00,
+    0x00,0x00,0x09,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xF2,0x00,0x00,
+    0x00,0x00,0x0E,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xF7,0x00,0x00,
+    0x00,0x00,0x0A,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xF3,0x00,0x00,
+    0x00,0x00,0x01,0xBF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFE,0x60,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    /* '3' */
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x49,0xCF,0xFC,0x94,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x2B,0xFF,0xFF,0xFF,0xFF,0xB2,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x03,0xEF,0xFF,0xFF,0xFF,0xFF,0xFE,0x30,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x3E,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xE3,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0xCF,0xFF,0xFF,0xFD,0xDF,0xFF,0xFF,0xFC,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x06,0xFF,0xFF,0xFA,0x20,0x02,0xAF,0xFF,0xFF,0x60,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x0D,0xFF,0xFF,0x90,0x00,0x00,0x09,0xFF,0xFF,0xD0,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x0D,0xFF,0xFE,0x10,0x00,0x00,0x01,0xEF,0xFF,0xF5,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x06,0xFF,0xF5,0x00,0x00,0x00,0x00,0x8F,0xFF,0xF8,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x48,0x30,0x00,0x00,0x00,0x00,0x2F,0xFF,0xFB,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x0F,0xFF,0xFD,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x0C,0xFF,0xFF,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x0F,0xFF,0xFF,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x1F,0xFF,0xFB,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x5F,0xFF,0xFA,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xBF,0xFF,0xF6,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x06,0xFF,0xFF,0xF1,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x5E,0xFF,0xFF,0x90,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x05,0x8B,0xFF,0xFF,0xFE,0x20,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xCF,0xFF,0xFF,0xFF,0xF6,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x05,0xFF,0xFF,0xFF,0xFF,0xA0,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x05,0xFF,0xFF,0xFF,0xFF,0xE3,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xCF,0xFF,0xFF,0xFF,0xFE,0x30,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x05,0x89,0xEF,0xFF,0xFF,0xC0,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x1A,0xFF,0xFF,0xF8,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x9F,0xFF,0xFE,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x1D,0xFF,0xFF,0x50,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x06,0xFF,0xFF,0x80,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x02,0xFF,0xFF,0xB0,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xE0,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xF0,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xC0,0x00,0x00,
+    0x00,0x00,0x00,0x02,0x84,0x00,0x00,0x00,0x00,0x00,0x03,0xFF,0xFF,0xB0,0x00,0x00,
+    0x00,0x00,0x00,0x5F,0xFF,0x80,0x00,0x00,0x00,0x00,0x09,0xFF,0xFF,0x80,0x00,0x00,
+    0x00,0x00,0x00,0xBF,0xFF,0xF3,0x00,0x00,0x00,0x00,0x3F,0xFF,0xFF,0x30,0x00,0x00,
+    0x00,0x00,0x00,0xAF,0xFF,0xFE,0x30,0x00,0x00,0x03,0xEF,0xFF,0xFB,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x4F,0xFF,0xFF,0xE7,0x10,0x01,0x7E,0xFF,0xFF,0xF4,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x08,0xFF,0xFF,0xFF,0xFC,0xCF,0xFF,0xFF,0xFF,0x80,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0xCF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFC,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x19,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x91,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x6E,0xFF,0xFF,0xFF,0xFF,0xE6,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x6A,0xDF,0xFD,0xA6,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    /* '4' */
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x8E,0xD6,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x06,0xFF,0xFF,0x20,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x0D,0xFF,0xFF,0x40,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x6F,0xFF,0xFF,0x40,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xDF,0xFF,0xFF,0x40,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x06,0xFF,0xFF,0xFF,0x40,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x0D,0xFF,0xFF,0xFF,0x40,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x6F,0xFF,0xFF,0xFF,0x40,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xDF,0xFF,0xFF,0xFF,0x40,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x06,0xFF,0xFF,0xFF,0xFF,0x40,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x0D,0xFF,0xFF,0xFF,0xFF,0x40,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x6F,0xFF,0xFF,0xFF,0xFF,0x40,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0xDF,0xFF,0xFE,0xFF,0xFF,0x40,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x06,0xFF,0xFF,0xE8,0xFF,0xFF,0x40,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x0D,0xFF,0xFF,0x88,0xFF,0xFF,0x40,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x6F,0xFF,0xFE,0x18,0xFF,0xFF,0x40,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0xDF,0xFF,0xF8,0x08,0xFF,0xFF,0x40,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x06,0xFF,0xFF,0xE1,0x08,0xFF,0xFF,0x40,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x0D,0xFF,0xFF,0x80,0x08,0xFF,0xFF,0x40,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x6F,0xFF,0xFE,0x10,0x08,0xFF,0xFF,0x40,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0xDF,0xFF,0xF8,0x00,0x08,0xFF,0xFF,0x40,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x06,0xFF,0xFF,0xE1,0x00,0x08,0xFF,0xFF,0x40,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x0D,0xFF,0xFF,0x80,0x00,0x08,0xFF,0xFF,0x40,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x6F,0xFF,0xFE,0x10,0x00,0x08,0xFF,0xFF,0x40,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0xDF,0xFF,0xF8,0x00,0x00,0x08,0xFF,0xFF,0x40,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x06,0xFF,0xFF,0xE1,0x00,0x00,0x08,0xFF,0xFF,0x40,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x0D,0xFF,0xFF,0xEB,0xBB,0xBB,0xBD,0xFF,0xFF,0xCB,0xBB,0x92,0x00,0x00,
+    0x00,0x00,0x6F,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFC,0x00,0x00,
+    0x00,0x00,0xAF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x10,0x00,
+    0x00,0x00,0x7F,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFE,0x00,0x00,
+    0x00,0x00,0x08,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xD3,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x08,0xFF,0xFF,0x40,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x08,0xFF,0xFF,0x40,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x08,0xFF,0xFF,0x40,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x08,0xFF,0xFF,0x40,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x08,0xFF,0xFF,0x40,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x08,0xFF,0xFF,0x40,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x08,0xFF,0xFF,0x40,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x08,0xFF,0xFF,0x40,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x08,0xFF,0xFF,0x40,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x06,0xFF,0xFF,0x20,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x8E,0xD6,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    /* '5' */
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x01,0x9F,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xD4,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x08,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFE,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x0B,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x40,0x00,0x00,
+    0x00,0x00,0x00,0x0B,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFD,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x0B,0xFF,0xFF,0xBB,0xBB,0xBB,0xBB,0xBB,0xBB,0xA3,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x0F,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x0F,0xFF,0xFB,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x0F,0xFF,0xFB,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x0F,0xFF,0xFB,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x2F,0xFF,0xFB,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x4F,0xFF,0xF9,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x4F,0xFF,0xF8,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x4F,0xFF,0xF8,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x4F,0xFF,0xF8,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x8F,0xFF,0xF8,0x04,0x88,0x88,0x40,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x8F,0xFF,0xF8,0xDF,0xFF,0xFF,0xFD,0x60,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x8F,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFB,0x10,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x8F,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xC1,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x9F,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFC,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0xBF,0xFF,0xFF,0xFE,0x84,0x48,0xEF,0xFF,0xFF,0x80,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x8F,0xFF,0xFF,0xC1,0x00,0x00,0x1C,0xFF,0xFF,0xE2,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x1C,0xFF,0xFC,0x10,0x00,0x00,0x01,0xDF,0xFF,0xF8,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x37,0x71,0x00,0x00,0x00,0x00,0x5F,0xFF,0xFE,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x0C,0xFF,0xFF,0x40,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x07,0xFF,0xFF,0x80,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x03,0xFF,0xFF,0xB0,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xB0,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xF0,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xF0,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xC0,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x02,0xFF,0xFF,0xB0,0x00,0x00,
+    0x00,0x00,0x00,0x04,0x86,0x00,0x00,0x00,0x00,0x00,0x06,0xFF,0xFF,0x80,0x00,0x00,
+    0x00,0x00,0x00,0x5F,0xFF,0x80,0x00,0x00,0x00,0x00,0x09,0xFF,0xFF,0x60,0x00,0x00,
+    0x00,0x00,0x00,0xBF,0xFF,0xF2,0x00,0x00,0x00,0x00,0x2F,0xFF,0xFF,0x10,0x00,0x00,
+    0x00,0x00,0x00,0xAF,0xFF,0xFA,0x00,0x00,0x00,0x00,0xAF,0xFF,0xFA,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x4F,0xFF,0xFF,0x80,0x00,0x00,0x08,0xFF,0xFF,0xF4,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x0B,0xFF,0xFF,0xFA,0x20,0x02,0xAF,0xFF,0xFF,0xB0,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x02,0xEF,0xFF,0xFF,0xFC,0xDF,0xFF,0xFF,0xFE,0x20,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x4F,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xF5,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x05,0xEF,0xFF,0xFF,0xFF,0xFF,0xFE,0x50,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x2B,0xFF,0xFF,0xFF,0xFF,0xB2,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x49,0xDF,0xFC,0x94,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    /* '6' */
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x37,0x88,0x62,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x4B,0xFF,0xFF,0xFF,0x92,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x08,0xFF,0xFF,0xFF,0xFF,0xFC,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x9F,0xFF,0xFF,0xFF,0xFF,0xFF,0x30,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x07,0xFF,0xFF,0xFF,0xFF,0xFF,0xFE,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x3F,0xFF,0xFF,0xF9,0x45,0x9F,0xD5,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0xDF,0xFF,0xFE,0x40,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x06,0xFF,0xFF,0xF5,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x0D,0xFF,0xFF,0x80,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x6F,0xFF,0xFE,0x10,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0xCF,0xFF,0xF6,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x02,0xFF,0xFF,0xE1,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x07,0xFF,0xFF,0x90,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x0C,0xFF,0xFF,0x30,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x1F,0xFF,0xFE,0x03,0x88,0x88,0x30,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x4F,0xFF,0xFC,0xCF,0xFF,0xFF,0xFC,0x40,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x8F,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xF8,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0xAF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x90,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0xDF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xF7,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0x84,0x48,0xFF,0xFF,0xFF,0x20,0x00,0x00,0x00,
+    0x00,0x00,0x02,0xFF,0xFF,0xFF,0xE3,0x00,0x00,0x3E,0xFF,0xFF,0x90,0x00,0x00,0x00,
+    0x00,0x00,0x04,0xFF,0xFF,0xFF,0x50,0x00,0x00,0x05,0xFF,0xFF,0xF2,0x00,0x00,0x00,
+    0x00,0x00,0x04,0xFF,0xFF,0xFB,0x00,0x00,0x00,0x00,0xBF,0xFF,0xF8,0x00,0x00,0x00,
+    0x00,0x00,0x05,0xFF,0xFF,0xF4,0x00,0x00,0x00,0x00,0x4F,0xFF,0xFC,0x00,0x00,0x00,
+    0x00,0x00,0x08,0xFF,0xFF,0xD0,0x00,0x00,0x00,0x00,0x0D,0xFF,0xFF,0x10,0x00,0x00,
+    0x00,0x00,0x08,0xFF,0xFF,0x90,0x00,0x00,0x00,0x00,0x09,0xFF,0xFF,0x40,0x00,0x00,
+    0x00,0x00,0x08,0xFF,0xFF,0x80,0x00,0x00,0x00,0x00,0x08,0xFF,0xFF,0x40,0x00,0x00,
+    0x00,0x00,0x08,0xFF,0xFF,0x80,0x00,0x00,0x00,0x00,0x08,0xFF,0xFF,0x80,0x00,0x00,
+    0x00,0x00,0x08,0xFF,0xFF,0x80,0x00,0x00,0x00,0x00,0x08,0xFF,0xFF,0x80,0x00,0x00,
+    0x00,0x00,0x05,0xFF,0xFF,0x80,0x00,0x00,0x00,0x00,0x08,0xFF,0xFF,0x50,0x00,0x00,
+    0x00,0x00,0x04,0xFF,0xFF,0x80,0x00,0x00,0x00,0x00,0x08,0xFF,0xFF,0x40,0x00,0x00,
+    0x00,0x00,0x02,0xFF,0xFF,0xC0,0x00,0x00,0x00,0x00,0x0C,0xFF,0xFF,0x20,0x00,0x00,
+    0x00,0x00,0x00,0xDF,0xFF,0xF2,0x00,0x00,0x00,0x00,0x2F,0xFF,0xFD,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x9F,0xFF,0xF8,0x00,0x00,0x00,0x00,0x8F,0xFF,0xF9,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x5F,0xFF,0xFE,0x20,0x00,0x00,0x02,0xEF,0xFF,0xF5,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x0D,0xFF,0xFF,0xC1,0x00,0x00,0x1C,0xFF,0xFF,0xD0,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x05,0xFF,0xFF,0xFC,0x30,0x03,0xCF,0xFF,0xFF,0x50,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0xBF,0xFF,0xFF,0xFD,0xDF,0xFF,0xFF,0xFB,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x1D,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xD1,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x01,0xCF,0xFF,0xFF,0xFF,0xFF,0xFC,0x10,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x19,0xFF,0xFF,0xFF,0xFF,0x91,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x28,0xCF,0xFC,0x82,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    /* '7' */
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x08,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x80,0x00,0x00,
+    0x00,0x00,0x7F,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xF7,0x00,0x00,
+    0x00,0x00,0x9F,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xF9,0x00,0x00,
+    0x00,0x00,0x6F,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xF7,0x00,0x00,
+    0x00,0x00,0x08,0xBB,0xBB,0xBB,0xBB,0xBB,0xBB,0xBB,0xBB,0xFF,0xFF,0xF2,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x04,0xFF,0xFF,0xC0,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x08,0xFF,0xFF,0x70,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x0D,0xFF,0xFF,0x20,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x3F,0xFF,0xFD,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x8F,0xFF,0xF8,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xCF,0xFF,0xF3,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x02,0xFF,0xFF,0xD0,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x07,0xFF,0xFF,0x90,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x0B,0xFF,0xFF,0x50,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x1F,0xFF,0xFE,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x6F,0xFF,0xF9,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xAF,0xFF,0xF5,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0xFF,0xFF,0xF1,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x05,0xFF,0xFF,0xA0,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x09,0xFF,0xFF,0x60,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x0E,0xFF,0xFF,0x10,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x5F,0xFF,0xFC,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x8F,0xFF,0xF7,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xDF,0xFF,0xF2,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x03,0xFF,0xFF,0xC0,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x08,0xFF,0xFF,0x80,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x0D,0xFF,0xFF,0x30,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x2F,0xFF,0xFD,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x7F,0xFF,0xF8,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xCF,0xFF,0xF4,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x02,0xFF,0xFF,0xE0,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x06,0xFF,0xFF,0x90,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x0A,0xFF,0xFF,0x50,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x1F,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x6F,0xFF,0xFA,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0xAF,0xFF,0xF6,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0xEF,0xFF,0xF1,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x05,0xFF,0xFF,0xA0,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x09,0xFF,0xFF,0x70,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x0B,0xFF,0xFF,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x09,0xFF,0xFB,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x01,0xBF,0xB3,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    /* '8' */
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x28,0xCF,0xFC,0x82,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x08,0xFF,0xFF,0xFF,0xFF,0x80,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x01,0xBF,0xFF,0xFF,0xFF,0xFF,0xFB,0x10,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x09,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x90,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x5F,0xFF,0xFF,0xFD,0xDF,0xFF,0xFF,0xF5,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0xDF,0xFF,0xFE,0x40,0x04,0xEF,0xFF,0xFD,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x06,0xFF,0xFF,0xE3,0x00,0x00,0x3E,0xFF,0xFF,0x60,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x0A,0xFF,0xFF,0x80,0x00,0x00,0x08,0xFF,0xFF,0xA0,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x0E,0xFF,0xFF,0x10,0x00,0x00,0x01,0xFF,0xFF,0xE0,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x1F,0xFF,0xFB,0x00,0x00,0x00,0x00,0xBF,0xFF,0xF1,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x4F,0xFF,0xFA,0x00,0x00,0x00,0x00,0xAF,0xFF,0xF4,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x4F,0xFF,0xF8,0x00,0x00,0x00,0x00,0x8F,0xFF,0xF4,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x3F,0xFF,0xFB,0x00,0x00,0x00,0x00,0xBF,0xFF,0xF3,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x0F,0xFF,0xFD,0x00,0x00,0x00,0x00,0xDF,0xFF,0xF0,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x0C,0xFF,0xFF,0x30,0x00,0x00,0x03,0xFF,0xFF,0xC0,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x08,0xFF,0xFF,0xA0,0x00,0x00,0x0A,0xFF,0xFF,0x80,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x02,0xFF,0xFF,0xF6,0x00,0x00,0x6F,0xFF,0xFF,0x20,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x9F,0xFF,0xFF,0xA5,0x5A,0xFF,0xFF,0xF9,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x2E,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xE2,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x06,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x60,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x1B,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xB1,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x9F,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xF9,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x07,0xFF,0xFF,0xFF,0xC8,0x8C,0xFF,0xFF,0xFF,0x70,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x2E,0xFF,0xFF,0xE4,0x00,0x00,0x4E,0xFF,0xFF,0xE2,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x8F,0xFF,0xFE,0x30,0x00,0x00,0x03,0xEF,0xFF,0xF8,0x00,0x00,0x00,
+    0x00,0x00,0x00,0xEF,0xFF,0xF5,0x00,0x00,0x00,0x00,0x5F,0xFF,0xFE,0x00,0x00,0x00,
+    0x00,0x00,0x04,0xFF,0xFF,0xC0,0x00,0x00,0x00,0x00,0x0C,0xFF,0xFF,0x40,0x00,0x00,
+    0x00,0x00,0x08,0xFF,0xFF,0x70,0x00,0x00,0x00,0x00,0x07,0xFF,0xFF,0x80,0x00,0x00,
+    0x00,0x00,0x08,0xFF,0xFF,0x40,0x00,0x00,0x00,0x00,0x04,0xFF,0xFF,0x80,0x00,0x00,
+    0x00,0x00,0x0B,0xFF,0xFF,0x40,0x00,0x00,0x00,0x00,0x04,0xFF,0xFF,0xB0,0x00,0x00,
+    0x00,0x00,0x0A,0xFF,0xFF,0x40,0x00,0x00,0x00,0x00,0x04,0xFF,0xFF,0xA0,0x00,0x00,
+    0x00,0x00,0x08,0xFF,0xFF,0x40,0x00,0x00,0x00,0x00,0x04,0xFF,0xFF,0x80,0x00,0x00,
+    0x00,0x00,0x07,0xFF,0xFF,0x80,0x00,0x00,0x00,0x00,0x08,0xFF,0xFF,0x70,0x00,0x00,
+    0x00,0x00,0x03,0xFF,0xFF,0xD0,0x00,0x00,0x00,0x00,0x0D,0xFF,0xFF,0x30,0x00,0x00,
+    0x00,0x00,0x00,0xDF,0xFF,0xF8,0x00,0x00,0x00,0x00,0x8F,0xFF,0xFD,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x7F,0xFF,0xFF,0x60,0x00,0x00,0x06,0xFF,0xFF,0xF7,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x1D,0xFF,0xFF,0xF8,0x10,0x01,0x8F,0xFF,0xFF,0xD1,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x04,0xFF,0xFF,0xFF,0xFC,0xCF,0xFF,0xFF,0xFF,0x40,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x6F,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xF6,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x07,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x70,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x4D,0xFF,0xFF,0xFF,0xFF,0xD4,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x59,0xDF,0xFD,0x95,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    /* '9' */
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x28,0xCF,0xFC,0x82,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x19,0xFF,0xFF,0xFF,0xFF,0x91,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x01,0xCF,0xFF,0xFF,0xFF,0xFF,0xFC,0x10,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x1D,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xD1,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0xBF,0xFF,0xFF,0xFD,0xDF,0xFF,0xFF,0xFB,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x05,0xFF,0xFF,0xFC,0x30,0x03,0xCF,0xFF,0xFF,0x50,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x0D,0xFF,0xFF,0xC1,0x00,0x00,0x1C,0xFF,0xFF,0xD0,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x5F,0xFF,0xFE,0x20,0x00,0x00,0x02,0xEF,0xFF,0xF5,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x9F,0xFF,0xF8,0x00,0x00,0x00,0x00,0x8F,0xFF,0xF9,0x00,0x00,0x00,
+    0x00,0x00,0x00,0xDF,0xFF,0xF2,0x00,0x00,0x00,0x00,0x2F,0xFF,0xFD,0x00,0x00,0x00,
+    0x00,0x00,0x02,0xFF,0xFF,0xC0,0x00,0x00,0x00,0x00,0x0C,0xFF,0xFF,0x20,0x00,0x00,
+    0x00,0x00,0x04,0xFF,0xFF,0x80,0x00,0x00,0x00,0x00,0x08,0xFF,0xFF,0x40,0x00,0x00,
+    0x00,0x00,0x05,0xFF,0xFF,0x80,0x00,0x00,0x00,0x00,0x08,0xFF,0xFF,0x50,0x00,0x00,
+    0x00,0x00,0x08,0xFF,0xFF,0x80,0x00,0x00,0x00,0x00,0x08,0xFF,0xFF,0x80,0x00,0x00,
+    0x00,0x00,0x08,0xFF,0xFF,0x80,0x00,0x00,0x00,0x00,0x08,0xFF,0xFF,0x80,0x00,0x00,
+    0x00,0x00,0x04,0xFF,0xFF,0x80,0x00,0x00,0x00,0x00,0x08,0xFF,0xFF,0x80,0x00,0x00,
+    0x00,0x00,0x04,0xFF,0xFF,0x90,0x00,0x00,0x00,0x00,0x09,0xFF,0xFF,0x80,0x00,0x00,
+    0x00,0x00,0x01,0xFF,0xFF,0xD0,0x00,0x00,0x00,0x00,0x0D,0xFF,0xFF,0x80,0x00,0x00,
+    0x00,0x00,0x00,0xCF,0xFF,0xF4,0x00,0x00,0x00,0x00,0x4F,0xFF,0xFF,0x50,0x00,0x00,
+    0x00,0x00,0x00,0x8F,0xFF,0xFB,0x00,0x00,0x00,0x00,0xBF,0xFF,0xFF,0x40,0x00,0x00,
+    0x00,0x00,0x00,0x2F,0xFF,0xFF,0x50,0x00,0x00,0x05,0xFF,0xFF,0xFF,0x40,0x00,0x00,
+    0x00,0x00,0x00,0x09,0xFF,0xFF,0xE3,0x00,0x00,0x3E,0xFF,0xFF,0xFF,0x20,0x00,0x00,
+    0x00,0x00,0x00,0x02,0xFF,0xFF,0xFF,0x84,0x48,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x7F,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFD,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x09,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFA,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x8F,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xF8,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x04,0xCF,0xFF,0xFF,0xFC,0xCF,0xFF,0xF4,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x03,0x88,0x88,0x30,0xEF,0xFF,0xF1,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x03,0xFF,0xFF,0xC0,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x09,0xFF,0xFF,0x70,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x1E,0xFF,0xFF,0x20,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x6F,0xFF,0xFC,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0xEF,0xFF,0xF6,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x08,0xFF,0xFF,0xD0,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x5F,0xFF,0xFF,0x60,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x04,0xEF,0xFF,0xFD,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x5D,0xF9,0x54,0x9F,0xFF,0xFF,0xF3,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0xEF,0xFF,0xFF,0xFF,0xFF,0xFF,0x70,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x03,0xFF,0xFF,0xFF,0xFF,0xFF,0xF9,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0xCF,0xFF,0xFF,0xFF,0xFF,0x80,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x29,0xFF,0xFF,0xFF,0xB4,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x26,0x88,0x73,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+};
+
+const GFX_DigitFont GFX_Digits32x48 = {
+    32, 48, 768, digits_32x48
+};
@@ -20,6 +20,12 @@ static uint16_t bg_color   = ILI9341_BLACK;
 static uint8_t text_size = 1;
 static uint8_t wrap = 1;
 
+static GFX_FillRectFn fill_rect = ILI9341_FillRect;
+static uint8_t to_panel = 1;        // fill_rect draws straight to the ILI9341
+static uint8_t glyph_runs = 1;      // opaque glyphs as one window each
+
+static const GFX_DigitFont *digit_font = NULL;
+
 /* ======== 5×7 Font (ASCII 32–126) ======== */
 /* Standard font from Adafruit GFX, flattened for STM32 */
 
@@ -55,30 +61,283 @@ static const uint8_t font5x7[] = {
   0x36,0x49,0x49,0x49,0x36,  // 8
   0x06,0x49,0x49,0x29,0x1E,  // 9
 
-  /* ASCII 0x3A ':' → ASCII 0x7E '~' (omitted here for brevity) */
+  /* ASCII 0x3A ':' */
+  0x00,0x36,0x36,0x00,0x00,  // :
+  0x00,0x56,0x36,0x00,0x00,  // ;
+  0x08,0x14,0x22,0x41,0x00,  // <
+  0x14,0x14,0x14,0x14,0x14,  // =
+  0x00,0x41,0x22,0x14,0x08,  // >
+  0x02,0x01,0x51,0x09,0x06,  // ?
+
+  /* ASCII 0x40 '@' */
+  0x32,0x49,0x79,0x41,0x3E,  // @
+  0x7E,0x11,0x11,0x11,0x7E,  // A
+  0x7F,0x49,0x49,0x49,0x36,  // B
+  0x3E,0x41,0x41,0x41,0x22,  // C
+  0x7F,0x41,0x41,0x22,0x1C,  // D
+  0x7F,0x49,0x49,0x49,0x41,  // E
+  0x7F,0x09,0x09,0x09,0x01,  // F
+  0x3E,0x41,0x49,0x49,0x7A,  // G
+  0x7F,0x08,0x08,0x08,0x7F,  // H
+  0x00,0x41,0x7F,0x41,0x00,  // I
+  0x20,0x40,0x41,0x3F,0x01,  // J
+  0x7F,0x08,0x14,0x22,0x41,  // K
+  0x7F,0x40,0x40,0x40,0x40,  // L
+  0x7F,0x02,0x0C,0x02,0x7F,  // M
+  0x7F,0x04,0x08,0x10,0x7F,  // N
+  0x3E,0x41,0x41,0x41,0x3E,  // O
+  0x7F,0x09,0x09,0x09,0x06,  // P
+  0x3E,0x41,0x51,0x21,0x5E,  // Q
+  0x7F,0x09,0x19,0x29,0x46,  // R
+  0x46,0x49,0x49,0x49,0x31,  // S
+  0x01,0x01,0x7F,0x01,0x01,  // T
+  0x3F,0x40,0x40,0x40,0x3F,  // U
+  0x1F,0x20,0x40,0x20,0x1F,  // V
+  0x3F,0x40,0x38,0x40,0x3F,  // W
+  0x63,0x14,0x08,0x14,0x63,  // X
+  0x07,0x08,0x70,0x08,0x07,  // Y
+  0x61,0x51,0x49,0x45,0x43,  // Z
+  0x00,0x7F,0x41,0x41,0x00,  // [
+  0x02,0x04,0x08,0x10,0x20,  // backslash
+  0x00,0x41,0x41,0x7F,0x00,  // ]
+  0x04,0x02,0x01,0x02,0x04,  // ^
+  0x40,0x40,0x40,0x40,0x40,  // _
+
+  /* ASCII 0x60 '`' */
+  0x00,0x01,0x02,0x04,0x00,  // `
+  0x20,0x54,0x54,0x54,0x78,  // a
+  0x7F,0x48,0x44,0x44,0x38,  // b
+  0x38,0x44,0x44,0x44,0x20,  // c
+  0x38,0x44,0x44,0x48,0x7F,  // d
+  0x38,0x54,0x54,0x54,0x18,  // e
+  0x08,0x7E,0x09,0x01,0x02,  // f
+  0x0C,0x52,0x52,0x52,0x3E,  // g
+  0x7F,0x08,0x04,0x04,0x78,  // h
+  0x00,0x44,0x7D,0x40,0x00,  // i
+  0x20,0x40,0x44,0x3D,0x00,  // j
+  0x7F,0x10,0x28,0x44,0x00,  // k
+  0x00,0x41,0x7F,0x40,0x00,  // l
+  0x7C,0x04,0x18,0x04,0x78,  // m
+  0x7C,0x08,0x04,0x04,0x78,  // n
+  0x38,0x44,0x44,0x44,0x38,  // o
+  0x7C,0x14,0x14,0x14,0x08,  // p
+  0x08,0x14,0x14,0x18,0x7C,  // q
+  0x7C,0x08,0x04,0x04,0x08,  // r
+  0x48,0x54,0x54,0x54,0x20,  // s
+  0x04,0x3F,0x44,0x40,0x20,  // t
+  0x3C,0x40,0x40,0x20,0x7C,  // u
+  0x1C,0x20,0x40,0x20,0x1C,  // v
+  0x3C,0x40,0x30,0x40,0x3C,  // w
+  0x44,0x28,0x10,0x28,0x44,  // x
+  0x0C,0x50,0x50,0x50,0x3C,  // y
+  0x44,0x64,0x54,0x4C,0x44,  // z
+  0x00,0x08,0x36,0x41,0x00,  // {
+  0x00,0x00,0x7F,0x00,0x00,  // |
+  0x00,0x41,0x36,0x08,0x00,  // }
+  0x08,0x04,0x08,0x10,0x08,  // ~
 };
 
-/* NOTE:
-   Only the first 10 digits + punctuation and control chars are shown above.
-   If you need the full ASCII set from 32–126, I will expand this table.
-   (To keep this message within the character limit.)
-*/
+_Static_assert(sizeof(font5x7) == (126 - 32 + 1) * 5,
+               "font5x7 must cover ASCII 32-126");
 
-/* ======== Internal Pixel Drawing Helper ======== */
+/* ======== Glyph Run Renderer ======== */
 
-static void drawPixel(uint16_t x, uint16_t y)
+/* Render callback, runs in the SPI IRQ. One job is one character cell
+ * (5 font columns + spacer, 7 rows) scaled by text_size; job->src points at
+ * the glyph's 5 column bytes in flash, job->arg holds the scale.
+ */
+static void glyph_render(const ILI9341_RenderJob *job, uint32_t first,
+                         uint16_t count, uint8_t *out)
 {
-    for (uint8_t i = 0; i < text_size; i++) {
-        for (uint8_t j = 0; j < text_size; j++) {
-            ILI9341_DrawPixel(x + i, y + j, text_color);
+    const uint8_t *glyph = (const uint8_t *)job->src;
+    uint8_t size = (uint8_t)job->arg;
+
+    uint16_t row = (uint16_t)(first / job->w);
+    uint16_t col = (uint16_t)(first % job->w);
+
+    uint8_t fg_hi = job->fg >> 8, fg_lo = job->fg & 0xFF;
+    uint8_t bg_hi = job->bg >> 8, bg_lo = job->bg & 0xFF;
+
+    while (count--) {
+        uint8_t fcol = col / size;
+        uint8_t lit  = (fcol < 5) && ((glyph[fcol] >> (row / size)) & 0x01);
+
+        *out++ = lit ? fg_hi : bg_hi;
+        *out++ = lit ? fg_lo : bg_lo;
+
+        if (++col == job->w) {
+            col = 0;
+            row++;
         }
     }
 }
 
+/* Opaque glyph as a single address window, or 0 if it cannot be done
+ * (transparent text, clipped cell, or drawing into the framebuffer).
+ */
+static uint8_t glyph_run(const uint8_t *glyph)
+{
+    uint16_t w = 6 * text_size;
+    uint16_t h = 7 * text_size;
+
+    if (!glyph_runs || !to_panel || (bg_color == text_color)) return 0;
+    if ((cursor_x + w > ILI9341_Width) || (cursor_y + h > ILI9341_Height)) return 0;
+
+    ILI9341_RenderJob job = {
+        .x = cursor_x, .y = cursor_y, .w = w, .h = h,
+        .fg = text_color, .bg = bg_color,
+        .src = glyph, .arg = text_size,
+    };
+    ILI9341_DrawRendered(&job, glyph_render);
+    return 1;
+}
+
+/* Fallback: one fill per vertical run of lit dots (and of background when
+ * opaque), so a glyph costs a handful of fills instead of one per dot.
+ */
+static void glyph_fills(const uint8_t *glyph)
+{
+    for (uint8_t col = 0; col < 6; col++) {
+        uint8_t line = (col < 5) ? glyph[col] : 0x00;
+        uint8_t row = 0;
+
+        while (row < 7) {
+            uint8_t lit = line & (1 << row);
+            uint8_t run = 1;
+            while ((row + run < 7) && (!(line & (1 << (row + run))) == !lit)) {
+                run++;
+            }
+
+            if (lit || (bg_color != text_color)) {
+                fill_rect(cursor_x + col * text_size,
+                          cursor_y + row * text_size,
+                          text_size,
+                          run * text_size,
+                          lit ? text_color : bg_color);
+            }
+            row += run;
+        }
+    }
+}
+
+/* ======== Large Digits ======== */
+
+/* Mix fg over bg by a 4-bit coverage value, per RGB565 channel. */
+static uint16_t blend565(uint16_t fg, uint16_t bg, uint8_t a)
+{
+    int32_t r = (bg >> 11),         dr = (int32_t)(fg >> 11) - r;
+    int32_t g = (bg >> 5) & 0x3F,   dg = (int32_t)((fg >> 5) & 0x3F) - g;
+    int32_t b = bg & 0x1F,          db = (int32_t)(fg & 0x1F) - b;
+
+    r += (dr * a) / 15;
+    g += (dg * a) / 15;
+    b += (db * a) / 15;
+
+    return (uint16_t)((r << 11) | (g << 5) | b);
+}
+
+/* Render callback, runs in the SPI IRQ. The glyph window is exactly the
+ * bitmap, so output pixel n is coverage nibble n: no scaling or indexing,
+ * just a 16-entry color lookup.
+ */
+static void digit_render(const ILI9341_RenderJob *job, uint32_t first,
+                         uint16_t count, uint8_t *out)
+{
+    const uint8_t *bits = (const uint8_t *)job->src;
+    uint16_t lut[16];
+
+    for (uint8_t a = 0; a < 16; a++) {
+        lut[a] = blend565(job->fg, job->bg, a);
+    }
+
+    while (count--) {
+        uint8_t byte = bits[first >> 1];
+        uint16_t c = lut[(first & 1) ? (byte & 0x0F) : (byte >> 4)];
+
+        *out++ = c >> 8;
+        *out++ = c & 0xFF;
+        first++;
+    }
+}
+
+/* Fallback for the framebuffer, clipped cells and transparent text: one
+ * fill per horizontal run of equal coverage. Transparent text only draws
+ * pixels that are at least half covered.
+ */
+static void digit_fills(const uint8_t *bits)
+{
+    uint8_t w = digit_font->w;
+    uint8_t opaque = (bg_color != text_color);
+
+    for (uint8_t y = 0; y < digit_font->h; y++) {
+        const uint8_t *row = bits + (uint16_t)y * (w / 2);
+        uint8_t x = 0;
+
+        while (x < w) {
+            uint8_t a = (x & 1) ? (row[x >> 1] & 0x0F) : (row[x >> 1] >> 4);
+            uint8_t run = 1;
+
+            while (x + run < w) {
+                uint8_t n = x + run;
+                uint8_t b = (n & 1) ? (row[n >> 1] & 0x0F) : (row[n >> 1] >> 4);
+                if (b != a) break;
+                run++;
+            }
+
+            if (opaque) {
+                fill_rect(cursor_x + x, cursor_y + y, run, 1,
+                          blend565(text_color, bg_color, a));
+            } else if (a >= 8) {
+                fill_rect(cursor_x + x, cursor_y + y, run, 1, text_color);
+            }
+            x += run;
+        }
+    }
+}
+
+static void digit_write(char c)
+{
+    uint16_t w = digit_font->w;
+    uint16_t h = digit_font->h;
+
+    if (wrap && (cursor_x + w >= ILI9341_Width)) {
+        cursor_x = 0;
+        cursor_y += h;
+    }
+
+    if (c == ' ') {
+        if (bg_color != text_color) {
+            fill_rect(cursor_x, cursor_y, w, h, bg_color);
+        }
+    } else {
+        const uint8_t *bits = digit_font->bitmaps +
+                              (uint16_t)(c - '0') * digit_font->glyph_bytes;
+
+        if (to_panel && (bg_color != text_color) &&
+            (cursor_x + w <= ILI9341_Width) && (cursor_y + h <= ILI9341_Height)) {
+            ILI9341_RenderJob job = {
+                .x = cursor_x, .y = cursor_y, .w = w, .h = h,
+                .fg = text_color, .bg = bg_color,
+                .src = bits, .arg = 0,
+            };
+            ILI9341_DrawRendered(&job, digit_render);
+        } else {
+            digit_fills(bits);
+        }
+    }
+
+    cursor_x += w;
+}
+
 /* ======== Character Rendering ======== */
 
 void GFX_WriteChar(char c)
 {
+    if (digit_font && (((c >= '0') && (c <= '9')) || (c == ' '))) {
+        digit_write(c);
+        return;
+    }
+
     if (c < 32 || c > 126)
         c = '?';
 
@@ -90,32 +349,10 @@ void GFX_WriteChar(char c)
         cursor_y += (8 * text_size);
     }
 
-    // Draw the glyph
-    for (uint8_t col = 0; col < 5; col++) {
-        uint8_t line = font5x7[char_index + col];
-
-        for (uint8_t row = 0; row < 7; row++) {
-            if (line & 0x01) {
-                drawPixel(cursor_x + col * text_size,
-                          cursor_y + row * text_size);
-            } else if (bg_color != text_color) {
-                ILI9341_FillRect(cursor_x + col * text_size,
-                                 cursor_y + row * text_size,
-                                 text_size,
-                                 text_size,
-                                 bg_color);
-            }
-            line >>= 1;
-        }
-    }
-
-    // 1-pixel spacer column
-    if (bg_color != text_color) {
-        ILI9341_FillRect(cursor_x + 5 * text_size,
-                         cursor_y,
-                         text_size,
-                         7 * text_size,
-                         bg_color);
+    // Draw the glyph and its 1-pixel spacer column
+    const uint8_t *glyph = &font5x7[char_index];
+    if (!glyph_run(glyph)) {
+        glyph_fills(glyph);
     }
 
     cursor_x += (6 * text_size);
@@ -145,6 +382,23 @@ void GFX_Init(void)
     bg_color = ILI9341_BLACK;
     text_size = 1;
     wrap = 1;
+    digit_font = NULL;
+}
+
+void GFX_SetFillRectFn(GFX_FillRectFn fn)
+{
+    fill_rect = fn ? fn : ILI9341_FillRect;
+    to_panel  = (fill_rect == ILI9341_FillRect);
+}
+
+void GFX_SetGlyphRuns(uint8_t enable)
+{
+    glyph_runs = enable;
+}
+
+void GFX_SetDigitFont(const GFX_DigitFont *font)
+{
+    digit_font = font;
 }
 
 void GFX_SetCursor(uint16_t x, uint16_t y)
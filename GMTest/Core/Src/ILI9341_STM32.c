@@ -21,33 +21,120 @@ uint16_t ILI9341_Height = ILI9341_TFTHEIGHT;
 #define MADCTL_BGR 0x08
 #define MADCTL_MH  0x04
 
+/* ======== Draw queue state ======== */
+
+enum {
+    ILI9341_OP_FILL = 0,    // repeat one color over the window
+    ILI9341_OP_BLIT,        // stream caller-owned RGB565 bytes
+    ILI9341_OP_RENDER,      // pixels produced chunk by chunk in the IRQ
+    ILI9341_OP_CMD          // bare command + arguments, no pixel phase
+};
+
+/* Compact draw op, pushed by the foreground and drained by the SPI
+ * TX-complete interrupt.
+ */
+typedef struct {
+    uint8_t  type;
+    uint16_t x0, y0, x1, y1;
+    uint16_t color;
+    const uint8_t *data;
+    ILI9341_RenderFn render;
+    ILI9341_RenderJob job;
+    uint8_t  cmd;                  // OP_CMD only
+    uint8_t  nargs;
+    uint8_t  args[6];
+} ILI9341_Op;
+
+static ILI9341_Op op_queue[ILI9341_QUEUE_LEN];
+static volatile uint16_t op_head = 0;      // written by foreground only
+static volatile uint16_t op_tail = 0;      // written by the SPI IRQ only
+
+static volatile uint8_t q_busy = 0;        // chain running, CS held low
+static ILI9341_QueueStats q_stats;
+
+/* Pixel phase of the op being streamed */
+static const uint8_t *px_src;
+static uint32_t       px_remaining;        // bytes still to send
+static uint8_t        px_repeat;           // 1 = resend the same color line
+
+/* Render ops: the next chunk is produced into one line while DMA sends the
+ * other.
+ */
+static ILI9341_RenderFn  gen_fn = NULL;
+static ILI9341_RenderJob gen_job;
+static uint32_t          gen_pos;          // next pixel to render
+static uint8_t           gen_ready;        // line holding the rendered chunk
+static uint16_t          gen_bytes;        // its length
+
+/* Two line buffers. A fill reuses whichever line already holds its color
+ * and only reformats (the older) one on a miss; render ops use both as a
+ * double buffer.
+ */
+static uint8_t  line_buf[2][ILI9341_DMA_LINE_PIXELS * 2];
+static uint16_t line_color[2];
+static uint16_t line_len[2];               // pixels formatted, 0 = empty
+static uint8_t  line_victim = 0;
+
+/* Window last sent from the queue; CASET/PASET are skipped when unchanged */
+static uint16_t win_x0, win_x1, win_y0, win_y1;
+static uint8_t  win_valid = 0;
+
+/* Hardware scroll state, in panel lines (see ILI9341_SetScrollArea) */
+static uint8_t  rotation = 0;
+static uint16_t scroll_tfa = 0;
+static uint16_t scroll_len = 0;            // 0 = no scroll area defined
+
+/* Bus transaction counters (see ILI9341_GetBusStats) */
+static ILI9341_BusStats bus_stats;
+
 /* ======== Low-level helpers ======== */
 
+/* All SPI and pin traffic goes through these so it can be counted */
+static void ILI9341_SpiTx(uint8_t *data, uint16_t len)
+{
+    bus_stats.transfers++;
+    bus_stats.bytes += len;
+    HAL_SPI_Transmit(&ILI9341_SPI_HANDLE, data, len, HAL_MAX_DELAY);
+}
+
+static void ILI9341_SpiTxDMA(uint8_t *data, uint16_t len)
+{
+    bus_stats.transfers++;
+    bus_stats.bytes += len;
+    HAL_SPI_Transmit_DMA(&ILI9341_SPI_HANDLE, data, len);
+}
+
 static void ILI9341_Select(void)
 {
+    bus_stats.gpio_writes++;
     HAL_GPIO_WritePin(ILI9341_CS_GPIO_Port, ILI9341_CS_Pin, GPIO_PIN_RESET);
 }
 
 static void ILI9341_Unselect(void)
 {
+    bus_stats.gpio_writes++;
     HAL_GPIO_WritePin(ILI9341_CS_GPIO_Port, ILI9341_CS_Pin, GPIO_PIN_SET);
 }
 
 static void ILI9341_DC_Command(void)
 {
+    bus_stats.gpio_writes++;
     HAL_GPIO_WritePin(ILI9341_DC_GPIO_Port, ILI9341_DC_Pin, GPIO_PIN_RESET);
 }
 
 static void ILI9341_DC_Data(void)
 {
+    bus_stats.gpio_writes++;
     HAL_GPIO_WritePin(ILI9341_DC_GPIO_Port, ILI9341_DC_Pin, GPIO_PIN_SET);
 }
 
 static void ILI9341_WriteCommand(uint8_t cmd)
 {
+    /* Blocking writes wait for the draw queue to release the bus */
+    ILI9341_WaitIdle();
     ILI9341_Select();
     ILI9341_DC_Command();
-    HAL_SPI_Transmit(&ILI9341_SPI_HANDLE, &cmd, 1, HAL_MAX_DELAY);
+    ILI9341_SpiTx(&cmd, 1);
     ILI9341_Unselect();
 }
 
@@ -63,26 +150,13 @@ static void ILI9341_Reset(void)
 
 static void ILI9341_WriteData(uint8_t data)
 {
+    ILI9341_WaitIdle();
     ILI9341_Select();
     ILI9341_DC_Data();
-    HAL_SPI_Transmit(&ILI9341_SPI_HANDLE, &data, 1, HAL_MAX_DELAY);
+    ILI9341_SpiTx(&data, 1);
     ILI9341_Unselect();
 }
 
-static void ILI9341_WriteDataBuffer(uint8_t *buff, uint16_t len)
-{
-    ILI9341_Select();
-    ILI9341_DC_Data();
-    HAL_SPI_Transmit(&ILI9341_SPI_HANDLE, buff, len, HAL_MAX_DELAY);
-    ILI9341_Unselect();
-}
-
-static void ILI9341_WriteData16(uint16_t data)
-{
-    uint8_t buf[2] = { data >> 8, data & 0xFF };
-    ILI9341_WriteDataBuffer(buf, 2);
-}
-
 /* ======== Initialization sequence (from Adafruit initcmd[]) ======== */
 
 static const uint8_t ili9341_init_cmds[] = {
@@ -134,8 +208,7 @@ static void ILI9341_RunInitSequence(void)
         if (numArgs) {
             ILI9341_Select();
             ILI9341_DC_Data();
-            HAL_SPI_Transmit(&ILI9341_SPI_HANDLE, (uint8_t *)addr, numArgs,
-                             HAL_MAX_DELAY);
+            ILI9341_SpiTx((uint8_t *)addr, numArgs);
             ILI9341_Unselect();
             addr += numArgs;
         }
@@ -146,106 +219,302 @@ static void ILI9341_RunInitSequence(void)
     }
 }
 
-/* ======== Address window & drawing primitives ======== */
+/* ======== Draw queue: IRQ side ======== */
 
-static void ILI9341_SetAddrWindow(uint16_t x0, uint16_t y0,
-                                  uint16_t x1, uint16_t y1)
+/* Send a command and its arguments while the chain holds CS low. These few
+ * bytes go out by polling, which is cheaper than a DMA round trip.
+ */
+static void ILI9341_SendCmd(uint8_t cmd, uint8_t *args, uint8_t nargs)
 {
-    /* Column address set */
-    ILI9341_WriteCommand(ILI9341_CASET);
-    uint8_t data_col[4] = {
-        x0 >> 8, x0 & 0xFF,
-        x1 >> 8, x1 & 0xFF
-    };
-    ILI9341_WriteDataBuffer(data_col, 4);
+    ILI9341_DC_Command();
+    ILI9341_SpiTx(&cmd, 1);
+    if (nargs) {
+        ILI9341_DC_Data();
+        ILI9341_SpiTx(args, nargs);
+    }
+}
 
-    /* Page address set */
-    ILI9341_WriteCommand(ILI9341_PASET);
-    uint8_t data_page[4] = {
-        y0 >> 8, y0 & 0xFF,
-        y1 >> 8, y1 & 0xFF
+/* CASET/PASET style command with its two 16-bit arguments */
+static void ILI9341_SendWindowCmd(uint8_t cmd, uint16_t a, uint16_t b)
+{
+    uint8_t args[4] = {
+        a >> 8, a & 0xFF,
+        b >> 8, b & 0xFF
     };
-    ILI9341_WriteDataBuffer(data_page, 4);
 
-    /* RAM write */
-    ILI9341_WriteCommand(ILI9341_RAMWR);
+    ILI9341_SendCmd(cmd, args, 4);
 }
 
-void ILI9341_DrawPixel(uint16_t x, uint16_t y, uint16_t color)
+static const uint8_t *ILI9341_ColorLine(uint16_t color, uint32_t pixels)
 {
-    if ((x >= ILI9341_Width) || (y >= ILI9341_Height)) return;
+    if (pixels > ILI9341_DMA_LINE_PIXELS) {
+        pixels = ILI9341_DMA_LINE_PIXELS;
+    }
+
+    for (uint8_t i = 0; i < 2; i++) {
+        if (line_len[i] >= pixels && line_color[i] == color) {
+            line_victim = i ^ 1;
+            return line_buf[i];
+        }
+    }
 
-    ILI9341_SetAddrWindow(x, y, x, y);
-    ILI9341_WriteData16(color);
+    uint8_t i = line_victim;
+    line_victim ^= 1;
+
+    for (uint32_t p = 0; p < pixels; p++) {
+        line_buf[i][2 * p]     = color >> 8;
+        line_buf[i][2 * p + 1] = color & 0xFF;
+    }
+    line_color[i] = color;
+    line_len[i]   = (uint16_t)pixels;
+    return line_buf[i];
 }
 
-void ILI9341_DrawFastHLine(uint16_t x, uint16_t y,
-                           uint16_t w, uint16_t color)
+/* Render the next chunk of the current render op into line gen_ready */
+static void ILI9341_RenderAhead(void)
 {
-    if ((y >= ILI9341_Height) || (x >= ILI9341_Width)) return;
+    uint32_t pixels = px_remaining / 2;
+    if (pixels > ILI9341_DMA_LINE_PIXELS) {
+        pixels = ILI9341_DMA_LINE_PIXELS;
+    }
 
-    if (x + w - 1 >= ILI9341_Width) {
-        w = ILI9341_Width - x;
+    line_len[gen_ready] = 0;    // no longer a cached color line
+    gen_fn(&gen_job, gen_pos, (uint16_t)pixels, line_buf[gen_ready]);
+    gen_pos  += pixels;
+    gen_bytes = (uint16_t)(pixels * 2);
+}
+
+static void ILI9341_StreamNext(void)
+{
+    if (gen_fn) {
+        uint8_t *buf = line_buf[gen_ready];
+        uint16_t len = gen_bytes;
+
+        px_remaining -= len;
+        ILI9341_SpiTxDMA(buf, len);
+
+        /* Overlap: render the following chunk while this one is sent */
+        gen_ready ^= 1;
+        if (px_remaining) {
+            ILI9341_RenderAhead();
+        }
+        return;
     }
 
-    ILI9341_SetAddrWindow(x, y, x + w - 1, y);
+    uint32_t chunk = px_remaining;
+    uint32_t max   = px_repeat ? sizeof(line_buf[0]) : ILI9341_DMA_MAX_CHUNK;
+    if (chunk > max) {
+        chunk = max;
+    }
+    px_remaining -= chunk;
 
-    uint8_t hi = color >> 8;
-    uint8_t lo = color & 0xFF;
-    uint32_t total = w;
-    ILI9341_Select();
-    ILI9341_DC_Data();
-    while (total--) {
-        uint8_t buf[2] = {hi, lo};
-        HAL_SPI_Transmit(&ILI9341_SPI_HANDLE, buf, 2, HAL_MAX_DELAY);
+    const uint8_t *src = px_src;
+    if (!px_repeat) {
+        px_src += chunk;
     }
-    ILI9341_Unselect();
+
+    ILI9341_SpiTxDMA((uint8_t *)src, (uint16_t)chunk);
 }
 
-void ILI9341_DrawFastVLine(uint16_t x, uint16_t y,
-                           uint16_t h, uint16_t color)
+/* Pop the next op, send only the window commands that changed, then start
+ * its pixel DMA. Command ops ahead of it are sent on the spot, since they
+ * have no DMA phase to wait for. Returns 0 when the queue is empty.
+ */
+static uint8_t ILI9341_StartOp(void)
 {
-    if ((x >= ILI9341_Width) || (y >= ILI9341_Height)) return;
+    while ((op_tail != op_head) && (op_queue[op_tail].type == ILI9341_OP_CMD)) {
+        ILI9341_Op *cmd_op = &op_queue[op_tail];
+        ILI9341_SendCmd(cmd_op->cmd, cmd_op->args, cmd_op->nargs);
+        op_tail = (op_tail + 1) % ILI9341_QUEUE_LEN;
+        q_stats.ops++;
+    }
 
-    if (y + h - 1 >= ILI9341_Height) {
-        h = ILI9341_Height - y;
+    if (op_tail == op_head) {
+        return 0;
     }
 
-    ILI9341_SetAddrWindow(x, y, x, y + h - 1);
+    ILI9341_Op op = op_queue[op_tail];
+    op_tail = (op_tail + 1) % ILI9341_QUEUE_LEN;
+    q_stats.ops++;
 
-    uint8_t hi = color >> 8;
-    uint8_t lo = color & 0xFF;
-    uint32_t total = h;
-    ILI9341_Select();
+    bus_stats.windows++;
+
+    if (!win_valid || op.x0 != win_x0 || op.x1 != win_x1) {
+        ILI9341_SendWindowCmd(ILI9341_CASET, op.x0, op.x1);
+        win_x0 = op.x0;
+        win_x1 = op.x1;
+    }
+    if (!win_valid || op.y0 != win_y0 || op.y1 != win_y1) {
+        ILI9341_SendWindowCmd(ILI9341_PASET, op.y0, op.y1);
+        win_y0 = op.y0;
+        win_y1 = op.y1;
+    }
+    win_valid = 1;
+
+    uint8_t cmd = ILI9341_RAMWR;
+    ILI9341_DC_Command();
+    ILI9341_SpiTx(&cmd, 1);
     ILI9341_DC_Data();
-    while (total--) {
-        uint8_t buf[2] = {hi, lo};
-        HAL_SPI_Transmit(&ILI9341_SPI_HANDLE, buf, 2, HAL_MAX_DELAY);
+
+    uint32_t pixels = (uint32_t)(op.x1 - op.x0 + 1) * (op.y1 - op.y0 + 1);
+    px_remaining = pixels * 2;
+
+    gen_fn = NULL;
+    if (op.type == ILI9341_OP_FILL) {
+        px_src    = ILI9341_ColorLine(op.color, pixels);
+        px_repeat = 1;
+    } else if (op.type == ILI9341_OP_BLIT) {
+        px_src    = op.data;
+        px_repeat = 0;
+    } else {
+        gen_fn    = op.render;
+        gen_job   = op.job;
+        gen_pos   = 0;
+        gen_ready = 0;
+        ILI9341_RenderAhead();
     }
+
+    ILI9341_StreamNext();
+    return 1;
+}
+
+/* Queue drained: release the bus */
+static void ILI9341_ChainEnd(void)
+{
     ILI9341_Unselect();
+    q_busy = 0;
 }
 
-void ILI9341_FillRect(uint16_t x, uint16_t y,
-                      uint16_t w, uint16_t h, uint16_t color)
+/* Advance the chain: next chunk, next op, or release the bus. */
+static void ILI9341_ChainStep(void)
+{
+    if (px_remaining) {
+        ILI9341_StreamNext();
+        return;
+    }
+    if (ILI9341_StartOp()) {
+        return;
+    }
+
+    ILI9341_ChainEnd();
+}
+
+void HAL_SPI_TxCpltCallback(SPI_HandleTypeDef *hspi)
 {
-    if ((x >= ILI9341_Width) || (y >= ILI9341_Height)) return;
+    if (hspi != &ILI9341_SPI_HANDLE) return;
+
+    ILI9341_ChainStep();
+}
 
-    if (x + w - 1 >= ILI9341_Width)  w = ILI9341_Width  - x;
-    if (y + h - 1 >= ILI9341_Height) h = ILI9341_Height - y;
+void HAL_SPI_ErrorCallback(SPI_HandleTypeDef *hspi)
+{
+    if (hspi != &ILI9341_SPI_HANDLE) return;
 
-    ILI9341_SetAddrWindow(x, y, x + w - 1, y + h - 1);
+    /* Drop the rest of this op and force a full window on the next one */
+    px_remaining = 0;
+    win_valid = 0;
+    ILI9341_ChainStep();
+}
 
-    uint8_t hi = color >> 8;
-    uint8_t lo = color & 0xFF;
-    uint32_t total = (uint32_t)w * h;
+/* ======== Draw queue: foreground side ======== */
 
-    ILI9341_Select();
-    ILI9341_DC_Data();
-    while (total--) {
-        uint8_t buf[2] = {hi, lo};
-        HAL_SPI_Transmit(&ILI9341_SPI_HANDLE, buf, 2, HAL_MAX_DELAY);
+static ILI9341_Op *ILI9341_QueueReserve(void)
+{
+    uint16_t next = (op_head + 1) % ILI9341_QUEUE_LEN;
+
+    if (next == op_tail) {
+        /* Overloaded: the only place the foreground waits on the display */
+        q_stats.stalls++;
+        while (next == op_tail) {
+        }
     }
-    ILI9341_Unselect();
+    return &op_queue[op_head];
+}
+
+static void ILI9341_QueueCommit(void)
+{
+    op_head = (op_head + 1) % ILI9341_QUEUE_LEN;
+
+    uint16_t depth = (op_head + ILI9341_QUEUE_LEN - op_tail) % ILI9341_QUEUE_LEN;
+    if (depth > q_stats.high_water) {
+        q_stats.high_water = depth;
+    }
+
+    /* The IRQ only clears q_busy, so a 0 here means no TX is in flight and
+     * nothing can race us for the bus. The kick runs with interrupts masked:
+     * a render op prepares its next chunk after starting DMA on the first,
+     * and a completion IRQ arriving before that would resend a stale line.
+     * PRIMASK is restored rather than cleared, for callers already masked.
+     */
+    if (!q_busy) {
+        q_busy = 1;
+        uint32_t primask = __get_PRIMASK();
+        __disable_irq();
+        ILI9341_Select();
+        if (!ILI9341_StartOp()) {
+            ILI9341_ChainEnd();     // only command ops were waiting
+        }
+        __set_PRIMASK(primask);
+    }
+}
+
+/* Queue a command whose arguments are 16-bit big-endian words */
+static void ILI9341_QueueCmd(uint8_t cmd, const uint16_t *words, uint8_t count)
+{
+    ILI9341_Op *op = ILI9341_QueueReserve();
+    op->type  = ILI9341_OP_CMD;
+    op->cmd   = cmd;
+    op->nargs = count * 2;
+    for (uint8_t i = 0; i < count; i++) {
+        op->args[2 * i]     = words[i] >> 8;
+        op->args[2 * i + 1] = words[i] & 0xFF;
+    }
+    ILI9341_QueueCommit();
+}
+
+static uint8_t ILI9341_ClipRect(uint16_t x, uint16_t y,
+                                uint16_t *w, uint16_t *h)
+{
+    if ((x >= ILI9341_Width) || (y >= ILI9341_Height)) return 0;
+    if ((*w == 0) || (*h == 0)) return 0;
+
+    if (x + *w - 1 >= ILI9341_Width)  *w = ILI9341_Width  - x;
+    if (y + *h - 1 >= ILI9341_Height) *h = ILI9341_Height - y;
+    return 1;
+}
+
+/* ======== Drawing primitives ======== */
+
+void ILI9341_DrawPixel(uint16_t x, uint16_t y, uint16_t color)
+{
+    ILI9341_FillRect(x, y, 1, 1, color);
+}
+
+void ILI9341_DrawFastHLine(uint16_t x, uint16_t y,
+                           uint16_t w, uint16_t color)
+{
+    ILI9341_FillRect(x, y, w, 1, color);
+}
+
+void ILI9341_DrawFastVLine(uint16_t x, uint16_t y,
+                           uint16_t h, uint16_t color)
+{
+    ILI9341_FillRect(x, y, 1, h, color);
+}
+
+void ILI9341_FillRect(uint16_t x, uint16_t y,
+                      uint16_t w, uint16_t h, uint16_t color)
+{
+    if (!ILI9341_ClipRect(x, y, &w, &h)) return;
+
+    ILI9341_Op *op = ILI9341_QueueReserve();
+    op->type  = ILI9341_OP_FILL;
+    op->x0    = x;
+    op->y0    = y;
+    op->x1    = x + w - 1;
+    op->y1    = y + h - 1;
+    op->color = color;
+    ILI9341_QueueCommit();
 }
 
 void ILI9341_FillScreen(uint16_t color)
@@ -253,6 +522,112 @@ void ILI9341_FillScreen(uint16_t color)
     ILI9341_FillRect(0, 0, ILI9341_Width, ILI9341_Height, color);
 }
 
+void ILI9341_DrawImage(uint16_t x, uint16_t y, uint16_t w, uint16_t h,
+                       const uint8_t *data)
+{
+    /* No clipping: the data has no stride, so it must fit as given */
+    if ((w == 0) || (h == 0)) return;
+    if ((x + w > ILI9341_Width) || (y + h > ILI9341_Height)) return;
+
+    ILI9341_Op *op = ILI9341_QueueReserve();
+    op->type = ILI9341_OP_BLIT;
+    op->x0   = x;
+    op->y0   = y;
+    op->x1   = x + w - 1;
+    op->y1   = y + h - 1;
+    op->data = data;
+    ILI9341_QueueCommit();
+}
+
+void ILI9341_DrawRendered(const ILI9341_RenderJob *job, ILI9341_RenderFn fn)
+{
+    if ((job->w == 0) || (job->h == 0)) return;
+    if ((job->x + job->w > ILI9341_Width) ||
+        (job->y + job->h > ILI9341_Height)) return;
+
+    ILI9341_Op *op = ILI9341_QueueReserve();
+    op->type   = ILI9341_OP_RENDER;
+    op->x0     = job->x;
+    op->y0     = job->y;
+    op->x1     = job->x + job->w - 1;
+    op->y1     = job->y + job->h - 1;
+    op->render = fn;
+    op->job    = *job;
+    ILI9341_QueueCommit();
+}
+
+/* ======== Hardware scrolling ======== */
+
+/* The panel scrolls along its 320 gate lines. Rotations 0 and 1 address
+ * them in order (screen y / screen x); 2 and 3 address them in reverse, so
+ * the fixed areas swap sides and the scroll direction flips.
+ */
+void ILI9341_SetScrollArea(uint16_t start, uint16_t len)
+{
+    if (start >= ILI9341_TFTHEIGHT) return;
+    if (start + len > ILI9341_TFTHEIGHT) len = ILI9341_TFTHEIGHT - start;
+    if (len == 0) return;
+
+    uint16_t before = start;
+    uint16_t after  = ILI9341_TFTHEIGHT - start - len;
+
+    if (rotation >= 2) {
+        uint16_t t = before;
+        before = after;
+        after  = t;
+    }
+
+    uint16_t def[3] = { before, len, after };
+    ILI9341_QueueCmd(ILI9341_VSCRDEF, def, 3);
+
+    scroll_tfa = before;
+    scroll_len = len;
+    ILI9341_ScrollTo(0);
+}
+
+void ILI9341_ScrollTo(uint16_t offset)
+{
+    if (scroll_len == 0) return;
+
+    offset %= scroll_len;
+    if ((rotation >= 2) && offset) {
+        offset = scroll_len - offset;
+    }
+
+    uint16_t vsp = scroll_tfa + offset;
+    ILI9341_QueueCmd(ILI9341_VSCRSADD, &vsp, 1);
+}
+
+/* ======== Queue status ======== */
+
+uint8_t ILI9341_IsBusy(void)
+{
+    return q_busy;
+}
+
+void ILI9341_WaitIdle(void)
+{
+    while (q_busy) {
+    }
+}
+
+void ILI9341_GetQueueStats(ILI9341_QueueStats *stats)
+{
+    *stats = q_stats;
+    stats->depth = (op_head + ILI9341_QUEUE_LEN - op_tail) % ILI9341_QUEUE_LEN;
+}
+
+void ILI9341_GetBusStats(ILI9341_BusStats *stats)
+{
+    *stats = bus_stats;
+}
+
+void ILI9341_ResetBusStats(void)
+{
+    ILI9341_BusStats zero = {0};
+    bus_stats = zero;
+}
+
 /* ======== Rotation ======== */
 
 void ILI9341_SetRotation(uint8_t m)
@@ -260,6 +635,8 @@ void ILI9341_SetRotation(uint8_t m)
     m %= 4;
     uint8_t madctl = 0;
 
+    rotation = m;
+
     switch (m) {
     case 0: // portrait
         madctl = (MADCTL_MX | MADCTL_BGR);
@@ -295,6 +672,7 @@ void ILI9341_Init(void)
     ILI9341_Unselect();
     ILI9341_Reset();
     ILI9341_RunInitSequence();
+    win_valid = 0;
 
     /* Default rotation */
     ILI9341_SetRotation(1);   // landscape for your UI
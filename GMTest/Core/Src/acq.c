@@ -0,0 +1,376 @@
+/*
+ * acq.c
+ *
+ *  Created on: Oct 17, 2026
+ *      Author: kings
+ */
+
+#include "acq.h"
+#include "adc.h"
+#include "tim.h"
+
+/* ======== Profiles ======== */
+
+static const ACQ_Profile profiles[ACQ_PROFILE_COUNT] = {
+    // name         sample time                  x10   os  shift  rate
+    [ACQ_PROFILE_FAST]      = { "fast",      ADC_SAMPLETIME_2CYCLES_5,     25, 0, 0, 2000 },
+    [ACQ_PROFILE_BALANCED]  = { "balanced",  ADC_SAMPLETIME_47CYCLES_5,   475, 4, 2, 1000 },
+    [ACQ_PROFILE_LOW_NOISE] = { "low-noise", ADC_SAMPLETIME_247CYCLES_5, 2475, 6, 2, 1000 },
+    [ACQ_PROFILE_LOW_POWER] = { "low-power", ADC_SAMPLETIME_92CYCLES_5,   925, 2, 0,  200 },
+};
+
+// HAL encodings, indexed by os_log2 and os_shift
+static const uint32_t os_ratio[9] = {
+    0,  // oversampling off
+    ADC_OVERSAMPLING_RATIO_2,  ADC_OVERSAMPLING_RATIO_4,
+    ADC_OVERSAMPLING_RATIO_8,  ADC_OVERSAMPLING_RATIO_16,
+    ADC_OVERSAMPLING_RATIO_32, ADC_OVERSAMPLING_RATIO_64,
+    ADC_OVERSAMPLING_RATIO_128, ADC_OVERSAMPLING_RATIO_256,
+};
+static const uint32_t os_shift[9] = {
+    ADC_RIGHTBITSHIFT_NONE,
+    ADC_RIGHTBITSHIFT_1, ADC_RIGHTBITSHIFT_2, ADC_RIGHTBITSHIFT_3,
+    ADC_RIGHTBITSHIFT_4, ADC_RIGHTBITSHIFT_5, ADC_RIGHTBITSHIFT_6,
+    ADC_RIGHTBITSHIFT_7, ADC_RIGHTBITSHIFT_8,
+};
+
+#define ACQ_MAX_BLOCK_LEN   (ACQ_MAX_RATE_HZ * ACQ_BLOCK_MS / 1000U)
+
+_Static_assert((ACQ_RING_LEN & (ACQ_RING_LEN - 1U)) == 0U,
+               "ACQ_RING_LEN must be a power of two");
+_Static_assert(ACQ_RING_LEN >= 2U * ACQ_MAX_BLOCK_LEN,
+               "ring must hold a block while the next one is copied in");
+
+/* ======== State ======== */
+
+// Written by DMA1 channel 1; the IRQ owns whichever half is not being filled
+static uint16_t acq_buf[2 * ACQ_MAX_BLOCK_LEN];
+
+// Samples, produced in the DMA IRQ and consumed by the main loop
+static SRING_Sample ring_buf[ACQ_RING_LEN];
+static SRING_Ring ring;
+
+static uint32_t dma_blocks;
+static volatile uint32_t overruns;
+static uint32_t block_seq;              // main loop side
+
+// Main loop side filtering, one block at a time
+static FLT_Chain *filter = NULL;
+static q31_t     work[ACQ_MAX_BLOCK_LEN];
+static uint16_t  filt_last;
+static ACQ_SampleSink sink = NULL;
+
+// Set from the current profile while stopped, read by the IRQ
+static ACQ_ProfileId profile = ACQ_PROFILE_BALANCED;
+static uint16_t block_len;
+static uint8_t  out_bits;
+static uint32_t ms_per_q16;             // sample period, ms in Q16
+static uint8_t  running = 0;
+static uint8_t  spot = 0;               // ACQ_StartSpot rather than ACQ_Start
+
+static uint32_t cpu_x100[ACQ_PROFILE_COUNT];
+static uint32_t spot_cycles;
+
+/* ======== IRQ side ======== */
+
+static void block_done(const uint16_t *s)
+{
+    uint32_t start = DWT->CYCCNT;
+    uint8_t  up    = 16U - out_bits;
+    uint16_t top   = (uint16_t)(0xFFFFU << up);
+
+    // The last sample converted just now; earlier ones one period apart
+    uint32_t t0 = HAL_GetTick() -
+                  (((uint32_t)(block_len - 1U) * ms_per_q16) >> 16);
+
+    for (uint16_t i = 0; i < block_len; i++) {
+        uint16_t raw   = (uint16_t)(s[i] << up);
+        uint16_t flags = ((raw == 0U) || (raw == top)) ? SRING_FLAG_CLIP : 0U;
+        SRING_Push(&ring, t0 + ((i * ms_per_q16) >> 16), raw, flags);
+    }
+    dma_blocks++;
+
+    if (!spot) {
+        cpu_x100[profile] = (DWT->CYCCNT - start) * 100U / block_len;
+    }
+}
+
+void HAL_ADC_ConvHalfCpltCallback(ADC_HandleTypeDef *hadc)
+{
+    if (hadc->Instance == ADC1) {
+        block_done(&acq_buf[0]);
+    }
+}
+
+void HAL_ADC_ConvCpltCallback(ADC_HandleTypeDef *hadc)
+{
+    if (hadc->Instance == ADC1) {
+        block_done(&acq_buf[block_len]);
+    }
+}
+
+void HAL_ADC_ErrorCallback(ADC_HandleTypeDef *hadc)
+{
+    // HAL clears OVR before calling us, which lets the DMA requests resume
+    if ((hadc->Instance == ADC1) && (hadc->ErrorCode & HAL_ADC_ERROR_OVR)) {
+        overruns++;
+        SRING_MarkNext(&ring, SRING_FLAG_OVERRUN);
+    }
+}
+
+/* ======== Profile setup ======== */
+
+static uint8_t profile_ok(ACQ_ProfileId id)
+{
+    const ACQ_Profile *p = &profiles[id];
+    ACQ_ProfileInfo info;
+
+    ACQ_GetProfileInfo(id, &info);
+    return (p->rate_hz > 0U) && (p->rate_hz <= ACQ_MAX_RATE_HZ) &&
+           (ACQ_TIM_CLOCK_HZ % p->rate_hz == 0U) &&
+           (info.out_bits >= 12U) && (info.out_bits <= 16U) &&
+           (info.adc_duty_x10 < 1000U);
+}
+
+// ADC must be stopped. Same channel setup as MX_ADC1_Init otherwise;
+// a spot conversion is software triggered with the most oversampling.
+static void apply_profile(const ACQ_Profile *p)
+{
+    ADC_ChannelConfTypeDef sConfig = {0};
+    uint8_t os_log2 = spot ? ACQ_SPOT_OS_LOG2 : p->os_log2;
+    uint8_t shift   = spot ? ACQ_SPOT_OS_LOG2 - 4U : p->os_shift;
+
+    hadc1.Init.ExternalTrigConv = spot ? ADC_SOFTWARE_START : ADC_EXTERNALTRIG_T2_TRGO;
+    hadc1.Init.DMAContinuousRequests = spot ? DISABLE : ENABLE;
+    hadc1.Init.OversamplingMode = (os_log2 > 0U) ? ENABLE : DISABLE;
+    hadc1.Init.Oversampling.Ratio = os_ratio[os_log2];
+    hadc1.Init.Oversampling.RightBitShift = os_shift[shift];
+    hadc1.Init.Oversampling.TriggeredMode = ADC_TRIGGEREDMODE_SINGLE_TRIGGER;
+    hadc1.Init.Oversampling.OversamplingStopReset = ADC_REGOVERSAMPLING_CONTINUED_MODE;
+    if (HAL_ADC_Init(&hadc1) != HAL_OK) {
+        Error_Handler();
+    }
+
+    sConfig.Channel = ADC_CHANNEL_8;
+    sConfig.Rank = ADC_REGULAR_RANK_1;
+    sConfig.SamplingTime = p->sample_time;
+    sConfig.SingleDiff = ADC_SINGLE_ENDED;
+    sConfig.OffsetNumber = ADC_OFFSET_NONE;
+    sConfig.Offset = 0;
+    if (HAL_ADC_ConfigChannel(&hadc1, &sConfig) != HAL_OK) {
+        Error_Handler();
+    }
+
+    __HAL_TIM_SET_AUTORELOAD(&htim2, ACQ_TIM_CLOCK_HZ / p->rate_hz - 1U);
+    __HAL_TIM_SET_COUNTER(&htim2, 0);
+
+    block_len  = spot ? 1U : p->rate_hz * ACQ_BLOCK_MS / 1000U;
+    out_bits   = 12U + os_log2 - shift;
+    ms_per_q16 = (1000U << 16) / p->rate_hz;
+}
+
+/* ======== Public API ======== */
+
+static void start(void)
+{
+    SRING_Init(&ring, ring_buf, ACQ_RING_LEN);
+    dma_blocks = 0;
+    overruns   = 0;
+    block_seq  = 0;
+    filt_last  = 0;
+    if (filter != NULL) {
+        FLT_ChainReset(filter);
+    }
+
+    // Cycle counter for the per-sample cost figures
+    CoreDebug->DEMCR |= CoreDebug_DEMCR_TRCENA_Msk;
+    DWT->CTRL |= DWT_CTRL_CYCCNTENA_Msk;
+
+    apply_profile(&profiles[profile]);
+
+    if (HAL_ADCEx_Calibration_Start(&hadc1, ADC_SINGLE_ENDED) != HAL_OK) {
+        Error_Handler();
+    }
+}
+
+void ACQ_Start(void)
+{
+    if (running) return;
+
+    spot = 0;
+    start();
+    if (HAL_ADC_Start_DMA(&hadc1, (uint32_t *)acq_buf,
+                          2U * block_len) != HAL_OK) {
+        Error_Handler();
+    }
+    // TRGO only; the update interrupt is not needed
+    HAL_TIM_Base_Start(&htim2);
+    running = 1;
+}
+
+void ACQ_Stop(void)
+{
+    if (!running) return;
+
+    if (!spot) {
+        HAL_TIM_Base_Stop(&htim2);
+        HAL_ADC_Stop_DMA(&hadc1);
+    }
+    running = 0;
+}
+
+void ACQ_StartSpot(void)
+{
+    if (running) return;
+
+    spot = 1;
+    start();
+    running = 1;
+}
+
+uint8_t ACQ_Spot(void)
+{
+    uint8_t ok = 0;
+
+    if (!running || !spot) return 0;
+
+    uint32_t start_cyc = DWT->CYCCNT;
+    if ((HAL_ADC_Start(&hadc1) == HAL_OK) &&
+        (HAL_ADC_PollForConversion(&hadc1, ACQ_SPOT_TIMEOUT_MS) == HAL_OK)) {
+        acq_buf[0] = (uint16_t)HAL_ADC_GetValue(&hadc1);
+        ok = 1;
+    }
+    // Disabled until the next spot, so the ADC draws nothing in Stop2
+    HAL_ADC_Stop(&hadc1);
+    if (!ok) return 0;
+
+    block_done(acq_buf);
+    spot_cycles = DWT->CYCCNT - start_cyc;
+    return 1;
+}
+
+void ACQ_SetFilter(FLT_Chain *chain)
+{
+    filter = chain;
+    if (filter != NULL) {
+        FLT_ChainReset(filter);
+    }
+}
+
+void ACQ_SetSampleSink(ACQ_SampleSink fn)
+{
+    sink = fn;
+}
+
+uint8_t ACQ_SetProfile(ACQ_ProfileId id)
+{
+    if ((id >= ACQ_PROFILE_COUNT) || !profile_ok(id)) return 0;
+
+    uint8_t was_running = running;
+    ACQ_Stop();
+    profile = id;
+    if (was_running) {
+        if (spot) ACQ_StartSpot(); else ACQ_Start();
+    }
+    return 1;
+}
+
+ACQ_ProfileId ACQ_GetProfile(void)
+{
+    return profile;
+}
+
+const ACQ_Profile *ACQ_GetProfileDef(ACQ_ProfileId id)
+{
+    return (id < ACQ_PROFILE_COUNT) ? &profiles[id] : NULL;
+}
+
+// Resolution and ADC time of one output sample at a given oversampling
+static void conv_info(const ACQ_Profile *p, uint8_t os_log2, uint8_t shift,
+                      ACQ_ProfileInfo *info)
+{
+    // Averaging 4^n conversions buys n bits over white noise, up to the
+    // bits the oversampler actually keeps after its shift
+    uint32_t bits_x10 = 120U + 5U * os_log2;
+    info->out_bits = 12U + os_log2 - shift;
+    info->enob_x10 = (bits_x10 < info->out_bits * 10U) ? bits_x10 :
+                     info->out_bits * 10U;
+
+    // 12.5 clocks of successive approximation after each sample time
+    uint32_t clocks_x10 = (uint32_t)(p->sample_x10 + 125U) << os_log2;
+    info->conv_ns = (uint32_t)((uint64_t)clocks_x10 * 100000000U /
+                               ACQ_ADC_CLOCK_HZ);
+}
+
+void ACQ_GetProfileInfo(ACQ_ProfileId id, ACQ_ProfileInfo *info)
+{
+    *info = (ACQ_ProfileInfo){0};
+    if (id >= ACQ_PROFILE_COUNT) return;
+
+    const ACQ_Profile *p = &profiles[id];
+
+    conv_info(p, p->os_log2, p->os_shift, info);
+    info->adc_duty_x10 = (uint16_t)((uint64_t)info->conv_ns * p->rate_hz /
+                                    1000000U);
+    info->cpu_cyc_x100 = cpu_x100[id];
+}
+
+void ACQ_GetSpotInfo(ACQ_ProfileInfo *info)
+{
+    *info = (ACQ_ProfileInfo){0};
+    conv_info(&profiles[profile], ACQ_SPOT_OS_LOG2, ACQ_SPOT_OS_LOG2 - 4U, info);
+}
+
+uint8_t ACQ_GetBlock(ACQ_Block *blk)
+{
+    if (SRING_Count(&ring) < block_len) return 0;
+
+    SRING_Sample smp;
+    uint32_t sum = 0;
+    uint16_t lo = 0xFFFF, hi = 0, flags = 0;
+
+    for (uint16_t i = 0; i < block_len; i++) {
+        SRING_Pop(&ring, &smp);
+        if (sink != NULL) sink(&smp);
+        work[i] = (q31_t)smp.raw << 15;
+        sum   += smp.raw;
+        flags |= smp.flags;
+        if (smp.raw < lo) lo = smp.raw;
+        if (smp.raw > hi) hi = smp.raw;
+    }
+
+    blk->seq    = block_seq++;
+    blk->tick   = smp.tick;
+    blk->mean16 = (uint16_t)((sum + block_len / 2U) / block_len);
+    blk->mean   = blk->mean16 >> 4;
+    blk->min    = lo >> 4;
+    blk->max    = hi >> 4;
+    blk->flags  = flags;
+
+    if ((filter == NULL) || spot) {
+        // The chain is tuned to the profile rate, spot readings are not
+        filt_last = blk->mean16;
+    } else {
+        uint32_t m = FLT_ChainProcess(filter, work, work, block_len);
+        if (m > 0U) {
+            q31_t v = work[m - 1] >> 15;
+            filt_last = (v < 0) ? 0U : (v > 0xFFFF) ? 0xFFFFU : (uint16_t)v;
+        } else if (blk->seq == 0U) {
+            filt_last = blk->mean16;    // nothing out of the CIC yet
+        }
+    }
+    blk->filt16 = filt_last;
+    return 1;
+}
+
+void ACQ_GetStats(ACQ_Stats *stats)
+{
+    SRING_Stats rs;
+
+    SRING_GetStats(&ring, &rs);
+    stats->blocks     = dma_blocks;
+    stats->dropped    = rs.dropped;
+    stats->overruns   = overruns;
+    stats->high_water = rs.high_water;
+    stats->spot_cycles = spot_cycles;
+}
@@ -0,0 +1,133 @@
+/*
+ * alarm.c
+ *
+ *  Created on: Oct 17, 2026
+ *      Author: kings
+ */
+
+#include "alarm.h"
+
+typedef struct {
+    Alarm_State state;
+    uint32_t    since;      // entered PENDING, or became ACTIVE
+    uint32_t    silenced;   // when acknowledged
+} alarm_t;
+
+static Alarm_Config cfg;
+static alarm_t alarms[ALARM_COUNT];
+
+static const char *const alarm_names[ALARM_COUNT + 1] = {
+    "low", "high", "rapid change", "none"
+};
+
+/* ======== State machine ======== */
+
+// set: the condition is on; clear: it is past the hysteresis band
+static uint8_t step(alarm_t *a, uint8_t set, uint8_t clear, uint32_t now)
+{
+    Alarm_State prev = a->state;
+
+    switch (a->state) {
+    case ALARM_IDLE:
+        if (set) {
+            a->state = ALARM_PENDING;
+            a->since = now;
+        }
+        break;
+
+    case ALARM_PENDING:
+        if (!set) {
+            a->state = ALARM_IDLE;
+        }
+        break;
+
+    case ALARM_SILENCED:
+        if (now - a->silenced >= cfg.silence_ms) {
+            a->state = ALARM_ACTIVE;
+        }
+        /* fall through */
+    case ALARM_ACTIVE:
+        if (clear && (now - a->since >= cfg.min_on_ms)) {
+            a->state = ALARM_IDLE;
+        }
+        break;
+    }
+
+    // No debounce delay: straight through PENDING in the same update
+    if ((a->state == ALARM_PENDING) && (now - a->since >= cfg.on_delay_ms)) {
+        a->state = ALARM_ACTIVE;
+        a->since = now;
+    }
+    return a->state != prev;
+}
+
+/* ======== Public API ======== */
+
+void Alarm_Init(const Alarm_Config *config)
+{
+    cfg = *config;
+    for (uint8_t i = 0; i < ALARM_COUNT; i++) {
+        alarms[i] = (alarm_t){ .state = ALARM_IDLE };
+    }
+}
+
+uint8_t Alarm_Update(uint32_t now, const Alarm_Input *in)
+{
+    uint8_t changed = 0;
+    uint8_t soon_low  = (cfg.predict_s > 0U) &&
+                        (in->predicted == TREND_LIMIT_LOW) &&
+                        (in->predict_s <= cfg.predict_s);
+    uint8_t soon_high = (cfg.predict_s > 0U) &&
+                        (in->predicted == TREND_LIMIT_HIGH) &&
+                        (in->predict_s <= cfg.predict_s);
+
+    uint8_t set   = (in->value < cfg.lower) || soon_low;
+    uint8_t clear = (in->value > cfg.lower + cfg.level_hyst) && !soon_low;
+    if (step(&alarms[ALARM_LOW], set, clear, now)) {
+        changed |= 1U << ALARM_LOW;
+    }
+
+    set   = (in->value > cfg.upper) || soon_high;
+    clear = (in->value < cfg.upper - cfg.level_hyst) && !soon_high;
+    if (step(&alarms[ALARM_HIGH], set, clear, now)) {
+        changed |= 1U << ALARM_HIGH;
+    }
+
+    int32_t rate = (in->slope < 0) ? -in->slope : in->slope;
+    set   = in->slope_valid && (rate > cfg.rate_limit);
+    clear = !in->slope_valid || (rate < cfg.rate_limit - cfg.rate_hyst);
+    if (step(&alarms[ALARM_RAPID], set, clear, now)) {
+        changed |= 1U << ALARM_RAPID;
+    }
+    return changed;
+}
+
+void Alarm_Acknowledge(uint32_t now)
+{
+    for (uint8_t i = 0; i < ALARM_COUNT; i++) {
+        if (alarms[i].state == ALARM_ACTIVE) {
+            alarms[i].state    = ALARM_SILENCED;
+            alarms[i].silenced = now;
+        }
+    }
+}
+
+Alarm_State Alarm_GetState(Alarm_Kind kind)
+{
+    return (kind < ALARM_COUNT) ? alarms[kind].state : ALARM_IDLE;
+}
+
+Alarm_Kind Alarm_Sounding(void)
+{
+    for (uint8_t i = 0; i < ALARM_COUNT; i++) {
+        if (alarms[i].state == ALARM_ACTIVE) {
+            return (Alarm_Kind)i;
+        }
+    }
+    return ALARM_NONE;
+}
+
+const char *Alarm_Name(Alarm_Kind kind)
+{
+    return alarm_names[(kind < ALARM_COUNT) ? kind : ALARM_COUNT];
+}
@@ -0,0 +1,59 @@
+/*
+ * buzzer.c
+ *
+ *  Created on: Oct 17, 2026
+ *      Author: kings
+ */
+
+#include "buzzer.h"
+#include "tim.h"
+
+static const Buzzer_Pattern *volatile playing = NULL;
+static volatile uint8_t slot;
+static uint32_t duty;
+
+void Buzzer_Init(void)
+{
+    duty = ((__HAL_TIM_GET_AUTORELOAD(&htim1) + 1U) * BUZZER_DUTY_PCT) / 100U;
+
+    __HAL_TIM_SET_COMPARE(&htim1, TIM_CHANNEL_3, 0);
+    HAL_TIM_PWM_Start(&htim1, TIM_CHANNEL_3);
+    HAL_TIM_Base_Start_IT(&htim1);
+}
+
+void Buzzer_Play(const Buzzer_Pattern *pattern)
+{
+    if (pattern == playing) return;
+
+    __disable_irq();
+    playing = pattern;
+    slot = 0;
+    __enable_irq();
+
+    // Silence now; the next update interrupt (within 100 ms) starts it
+    if (pattern == NULL) {
+        __HAL_TIM_SET_COMPARE(&htim1, TIM_CHANNEL_3, 0);
+    }
+}
+
+/* One call per BUZZER_SLOT_MS. CCR3 is preloaded, so what is written here
+ * takes effect at the next update event: every slot sounds for exactly
+ * one step, only 100 ms late.
+ */
+void HAL_TIM_PeriodElapsedCallback(TIM_HandleTypeDef *htim)
+{
+    if (htim->Instance != TIM1) return;
+
+    const Buzzer_Pattern *p = playing;
+    uint32_t ccr = 0;
+
+    if (p != NULL) {
+        if ((p->bits >> slot) & 1U) {
+            ccr = duty;
+        }
+        if (++slot >= p->slots) {
+            slot = 0;
+        }
+    }
+    __HAL_TIM_SET_COMPARE(&htim1, TIM_CHANNEL_3, ccr);
+}
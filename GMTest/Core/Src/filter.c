@@ -0,0 +1,217 @@
+/*
+ * filter.c
+ *
+ *  Created on: Oct 17, 2026
+ *      Author: kings
+ */
+
+#include "filter.h"
+#include "main.h"       // CMSIS DWT
+#include <string.h>
+
+/* ======== Median ======== */
+
+void FLT_MedianInit_q31(FLT_MedianInst_q31 *s, uint8_t len, q31_t fill)
+{
+    if (len > FLT_MEDIAN_MAX) len = FLT_MEDIAN_MAX;
+    if (len == 0U) len = 1U;
+    s->len = len | 1U;
+    s->pos = 0;
+    for (uint8_t i = 0; i < FLT_MEDIAN_MAX; i++) {
+        s->hist[i] = fill;
+    }
+}
+
+void FLT_Median_q31(FLT_MedianInst_q31 *s, const q31_t *src, q31_t *dst,
+                    uint32_t n)
+{
+    uint8_t len = s->len;
+    q31_t sorted[FLT_MEDIAN_MAX];
+
+    if (len == 1U) {
+        if (dst != src) memcpy(dst, src, n * sizeof(q31_t));
+        return;
+    }
+
+    for (uint32_t i = 0; i < n; i++) {
+        s->hist[s->pos] = src[i];
+        if (++s->pos == len) s->pos = 0;
+
+        // Insertion sort of at most 7 entries beats anything clever here
+        for (uint8_t j = 0; j < len; j++) {
+            q31_t v = s->hist[j];
+            int8_t k = (int8_t)j - 1;
+            while ((k >= 0) && (sorted[k] > v)) {
+                sorted[k + 1] = sorted[k];
+                k--;
+            }
+            sorted[k + 1] = v;
+        }
+        dst[i] = sorted[len / 2U];
+    }
+}
+
+/* ======== CIC decimator ======== */
+
+void FLT_CicInit_q31(FLT_CicInst_q31 *s, uint8_t order, uint8_t log2r)
+{
+    if (order > FLT_CIC_MAX_ORDER) order = FLT_CIC_MAX_ORDER;
+    if (order == 0U) order = 1U;
+    s->order = order;
+    s->log2r = log2r;
+    s->phase = 0;
+    memset(s->integ, 0, sizeof(s->integ));
+    memset(s->comb, 0, sizeof(s->comb));
+}
+
+uint32_t FLT_CicDecimate_q31(FLT_CicInst_q31 *s, const q31_t *src, q31_t *dst,
+                             uint32_t n)
+{
+    uint8_t  order = s->order;
+    uint16_t r     = (uint16_t)(1U << s->log2r);
+    uint8_t  gain  = order * s->log2r;   // R^N as a shift
+    uint32_t out   = 0;
+
+    for (uint32_t i = 0; i < n; i++) {
+        // Integrators in modular 64-bit arithmetic; the combs undo the wrap
+        s->integ[0] += (uint64_t)(int64_t)src[i];
+        for (uint8_t k = 1; k < order; k++) {
+            s->integ[k] += s->integ[k - 1];
+        }
+
+        if (++s->phase < r) continue;
+        s->phase = 0;
+
+        uint64_t v = s->integ[order - 1];
+        for (uint8_t k = 0; k < order; k++) {
+            uint64_t prev = s->comb[k];
+            s->comb[k] = v;
+            v -= prev;
+        }
+        dst[out++] = (q31_t)((int64_t)v >> gain);
+    }
+    return out;
+}
+
+/* ======== Biquad cascade ======== */
+
+void FLT_BiquadInit_q31(FLT_BiquadInst_q31 *s, uint8_t stages,
+                        const q31_t *coefs, uint8_t post_shift)
+{
+    if (stages > FLT_BIQUAD_MAX_STAGES) stages = FLT_BIQUAD_MAX_STAGES;
+    s->stages     = stages;
+    s->post_shift = post_shift;
+    s->coefs      = coefs;
+    memset(s->state, 0, sizeof(s->state));
+}
+
+void FLT_BiquadPrime_q31(FLT_BiquadInst_q31 *s, q31_t x)
+{
+    for (uint8_t i = 0; i < 4U * s->stages; i++) {
+        s->state[i] = x;
+    }
+}
+
+void FLT_Biquad_q31(FLT_BiquadInst_q31 *s, const q31_t *src, q31_t *dst,
+                    uint32_t n)
+{
+    uint8_t shift = 31U - s->post_shift;
+
+    for (uint8_t st = 0; st < s->stages; st++) {
+        const q31_t *c = &s->coefs[5U * st];
+        q31_t *d = &s->state[4U * st];
+        q31_t x1 = d[0], x2 = d[1], y1 = d[2], y2 = d[3];
+
+        for (uint32_t i = 0; i < n; i++) {
+            q31_t x = src[i];
+            int64_t acc = (int64_t)c[0] * x  + (int64_t)c[1] * x1 +
+                          (int64_t)c[2] * x2 + (int64_t)c[3] * y1 +
+                          (int64_t)c[4] * y2;
+            acc >>= shift;
+            if (acc > INT32_MAX) acc = INT32_MAX;
+            if (acc < INT32_MIN) acc = INT32_MIN;
+
+            x2 = x1;
+            x1 = x;
+            y2 = y1;
+            y1 = (q31_t)acc;
+            dst[i] = y1;
+        }
+
+        d[0] = x1; d[1] = x2; d[2] = y1; d[3] = y2;
+        src = dst;      // next stage filters this one's output
+    }
+
+    if ((s->stages == 0U) && (dst != src)) {
+        memcpy(dst, src, n * sizeof(q31_t));
+    }
+}
+
+/* ======== Chain ======== */
+
+void FLT_ChainInit(FLT_Chain *c, const FLT_Config *cfg)
+{
+    c->cfg = *cfg;
+    FLT_ChainReset(c);
+}
+
+void FLT_ChainReset(FLT_Chain *c)
+{
+    FLT_MedianInit_q31(&c->median, c->cfg.median_len, 0);
+    FLT_CicInit_q31(&c->cic, c->cfg.cic_order, c->cfg.cic_log2r);
+    FLT_BiquadInit_q31(&c->biquad, c->cfg.biquad_stages,
+                       c->cfg.biquad_coefs, c->cfg.biquad_shift);
+    c->settled       = 0;
+    c->median_primed = 0;
+    c->biquad_primed = 0;
+    c->stats = (FLT_Stats){0};
+}
+
+uint32_t FLT_ChainProcess(FLT_Chain *c, const q31_t *src, q31_t *dst,
+                          uint32_t n)
+{
+    uint32_t start = DWT->CYCCNT;
+    uint32_t m = n;
+
+    if (n == 0U) return 0;
+
+    if (!c->median_primed) {
+        FLT_MedianInit_q31(&c->median, c->cfg.median_len, src[0]);
+        c->median_primed = 1;
+    }
+    FLT_Median_q31(&c->median, src, dst, n);
+
+    if (c->cfg.cic_order > 0U) {
+        m = FLT_CicDecimate_q31(&c->cic, dst, dst, n);
+
+        // The first order-1 outputs only see part of the impulse response
+        uint32_t skip = 0;
+        while ((c->settled + 1U < c->cic.order) && (skip < m)) {
+            c->settled++;
+            skip++;
+        }
+        if (skip > 0U) {
+            m -= skip;
+            memmove(dst, &dst[skip], m * sizeof(q31_t));
+        }
+    }
+
+    if ((c->cfg.biquad_stages > 0U) && (m > 0U)) {
+        if (!c->biquad_primed) {
+            FLT_BiquadPrime_q31(&c->biquad, dst[0]);
+            c->biquad_primed = 1;
+        }
+        FLT_Biquad_q31(&c->biquad, dst, dst, m);
+    }
+
+    c->stats.last_cycles  = DWT->CYCCNT - start;
+    c->stats.cyc_x100     = c->stats.last_cycles * 100U / n;
+    c->stats.in_samples  += n;
+    c->stats.out_samples += m;
+    return m;
+}
+
+void FLT_ChainGetStats(const FLT_Chain *c, FLT_Stats *stats)
+{
+    *stats = c->stats;
+}
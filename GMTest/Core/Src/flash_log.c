@@ -0,0 +1,419 @@
+/*
+ * flash_log.c
+ *
+ *  Created on: Oct 17, 2026
+ *      Author: kings
+ */
+
+#include "flash_log.h"
+#include "checksum.h"
+#include "stm32l4xx_hal.h"
+#include <string.h>
+
+#ifndef FLOG_MEM
+#define FLOG_MEM        ((const uint8_t *)FLOG_ADDR)  // the host sim points this at its array
+#endif
+
+#define FLOG_PAGE_LEN   FLASH_PAGE_SIZE
+#define FLOG_ERASED     0xFFFFFFFFU
+
+_Static_assert((FLOG_QUEUE_LEN & (FLOG_QUEUE_LEN - 1U)) == 0U,
+               "FLOG_QUEUE_LEN must be a power of two");
+_Static_assert(FLOG_MAX_ENTRY / 8U + 4U <= FLOG_QUEUE_LEN,
+               "the queue must hold the longest entry and a page change");
+_Static_assert(FLOG_MAX_ENTRY + 16U <= FLOG_PAGE_LEN,
+               "an entry must fit an empty page");
+_Static_assert(FLOG_PAGES > FLOG_SPARE_PAGES + 1U,
+               "the ring needs pages beyond the spares");
+
+typedef enum {
+    FLOG_OP_PROGRAM,
+    FLOG_OP_COMMIT,         // an entry header: the entry is in once it is done
+    FLOG_OP_ERASE,
+} FLOG_OpKind;
+
+typedef struct {
+    uint64_t data;
+    uint32_t addr;          // page number for an erase
+    uint8_t  kind;
+} FLOG_Op;
+
+// Operation queue: the main loop adds at q_head, the flash IRQ runs from q_tail
+static FLOG_Op queue[FLOG_QUEUE_LEN];
+static volatile uint32_t q_head;
+static volatile uint32_t q_tail;
+static volatile uint8_t  op_busy;
+
+// Layout as queued, main loop side. Pages hold consecutive sequence
+// numbers from tail_seq at tail_page round to head_seq at head_page.
+static uint32_t head_page;
+static uint32_t head_seq;
+static uint32_t head_off;       // where the next entry goes
+static uint32_t tail_page;
+static uint32_t tail_seq;
+static FLOG_Iter  last;         // where the last appended entry went
+static FLOG_Stats stats;
+
+static uint32_t rd32(const uint8_t *p)
+{
+    uint32_t v;
+    memcpy(&v, p, sizeof(v));
+    return v;
+}
+
+static const uint8_t *page_mem(uint32_t page)
+{
+    return FLOG_MEM + page * FLOG_PAGE_LEN;
+}
+
+static uint32_t page_next(uint32_t page, uint32_t n)
+{
+    return (page + n) % FLOG_PAGES;
+}
+
+static uint8_t blank(const uint8_t *p, uint32_t len)
+{
+    for (uint32_t i = 0; i < len; i += 4) {
+        if (rd32(p + i) != FLOG_ERASED) return 0;
+    }
+    return 1;
+}
+
+static uint8_t page_valid(uint32_t page, uint32_t *seq)
+{
+    const uint8_t *pg = page_mem(page);
+
+    *seq = rd32(pg);
+    return rd32(pg + 4) == ~*seq;
+}
+
+static uint8_t hdr_check(uint16_t len, uint8_t type)
+{
+    return (uint8_t)~((len & 0xFF) ^ (len >> 8) ^ type);
+}
+
+/* Entry at off: 1 and the entry if it is whole, 0 at the first blank
+ * header, -1 if the header does not check out, -2 if only the payload
+ * does not (next is still good). Without crc the payload is not checked.
+ */
+static int8_t parse(const uint8_t *pg, uint32_t off, FLOG_Entry *e, uint32_t *next,
+                    uint8_t crc)
+{
+    if (off + 8U > FLOG_PAGE_LEN) return 0;
+
+    const uint8_t *h = pg + off;
+    if ((rd32(h) == FLOG_ERASED) && (rd32(h + 4) == FLOG_ERASED)) return 0;
+
+    uint16_t len  = h[0] | (h[1] << 8);
+    uint8_t  type = h[2];
+    uint32_t end  = off + 8U + ((len + 7U) & ~7U);
+
+    if ((len == 0) || (len > FLOG_MAX_ENTRY) || (type == 0) || (type == 0xFF) ||
+        (h[3] != hdr_check(len, type)) || (end > FLOG_PAGE_LEN)) {
+        return -1;
+    }
+    *next = end;
+    if (crc && (CSUM_Crc32(0, h + 8, len) != rd32(h + 4))) return -2;
+
+    e->type = type;
+    e->len  = len;
+    e->data = h + 8;
+    return 1;
+}
+
+/* ======== Flash operations ======== */
+
+static void op_done(uint8_t ok)
+{
+    uint8_t kind = queue[q_tail & (FLOG_QUEUE_LEN - 1U)].kind;
+
+    if (!ok) {
+        stats.errors++;
+    } else if (kind == FLOG_OP_COMMIT) {
+        stats.committed++;
+    } else if (kind == FLOG_OP_ERASE) {
+        stats.erases++;
+    }
+    q_tail++;
+    op_busy = 0;
+}
+
+/* Flash IRQ, or main loop with interrupts masked */
+static void start_next(void)
+{
+    while (!op_busy && (q_tail != q_head)) {
+        const FLOG_Op *op = &queue[q_tail & (FLOG_QUEUE_LEN - 1U)];
+        HAL_StatusTypeDef st;
+
+        op_busy = 1;
+        if (op->kind == FLOG_OP_ERASE) {
+            FLASH_EraseInitTypeDef erase = {
+                .TypeErase = FLASH_TYPEERASE_PAGES,
+                .Banks     = FLASH_BANK_2,
+                .Page      = op->addr,
+                .NbPages   = 1,
+            };
+            st = HAL_FLASHEx_Erase_IT(&erase);
+        } else {
+            st = HAL_FLASH_Program_IT(FLASH_TYPEPROGRAM_DOUBLEWORD, op->addr, op->data);
+        }
+        if (st != HAL_OK) {
+            op_done(0);
+        }
+    }
+}
+
+void HAL_FLASH_EndOfOperationCallback(uint32_t ReturnValue)
+{
+    (void)ReturnValue;
+    if (op_busy) op_done(1);
+}
+
+void HAL_FLASH_OperationErrorCallback(uint32_t ReturnValue)
+{
+    (void)ReturnValue;
+    if (op_busy) op_done(0);
+}
+
+void FLOG_IRQHandler(void)
+{
+    start_next();
+}
+
+static void kick(void)
+{
+    __disable_irq();
+    start_next();
+    __enable_irq();
+}
+
+static uint32_t q_free(void)
+{
+    return FLOG_QUEUE_LEN - (q_head - q_tail);
+}
+
+static void q_push(uint8_t kind, uint32_t addr, uint64_t data)
+{
+    FLOG_Op *op = &queue[q_head & (FLOG_QUEUE_LEN - 1U)];
+
+    op->kind = kind;
+    op->addr = addr;
+    op->data = data;
+    __DMB();
+    q_head++;
+}
+
+/* ======== Layout ======== */
+
+/* A page about to be erased leaves the log first if it is the oldest */
+static void erase_ahead(uint32_t page)
+{
+    if ((page == tail_page) && (tail_seq != head_seq)) {
+        tail_page = page_next(tail_page, 1);
+        tail_seq++;
+    }
+    q_push(FLOG_OP_ERASE, page, 0);
+}
+
+/* The page was erased ahead of time; the one FLOG_SPARE_PAGES further on
+ * is queued for erasing in its turn.
+ */
+static void open_page(uint32_t page)
+{
+    head_page = page;
+    head_seq++;
+    head_off = 8;
+    q_push(FLOG_OP_PROGRAM, FLOG_ADDR + page * FLOG_PAGE_LEN,
+           head_seq | ((uint64_t)~head_seq << 32));
+    erase_ahead(page_next(page, FLOG_SPARE_PAGES));
+}
+
+void FLOG_Init(void)
+{
+    uint32_t seq;
+    uint8_t  found = 0;
+
+    q_head = q_tail = 0;
+    op_busy = 0;
+    stats = (FLOG_Stats){0};
+
+    HAL_FLASH_Unlock();
+    __HAL_FLASH_CLEAR_FLAG(FLASH_FLAG_ALL_ERRORS);
+    HAL_NVIC_SetPriority(FLASH_IRQn, 0, 0);
+    HAL_NVIC_EnableIRQ(FLASH_IRQn);
+
+    // Newest page
+    for (uint32_t p = 0; p < FLOG_PAGES; p++) {
+        if (page_valid(p, &seq) && (!found || ((int32_t)(seq - head_seq) > 0))) {
+            head_page = p;
+            head_seq  = seq;
+            found = 1;
+        }
+    }
+
+    if (!found) {
+        // Nothing usable: start over at page 0, which open_page takes as
+        // erased like the spares after it
+        tail_page = 0;
+        tail_seq  = 1;
+        head_seq  = 0;
+        for (uint32_t p = 0; p < FLOG_SPARE_PAGES; p++) {
+            if (!blank(page_mem(p), FLOG_PAGE_LEN)) q_push(FLOG_OP_ERASE, p, 0);
+        }
+        open_page(0);
+    } else {
+        // Back from the head while sequence numbers run on
+        tail_page = head_page;
+        tail_seq  = head_seq;
+        for (uint32_t i = 1; i < FLOG_PAGES; i++) {
+            uint32_t p = page_next(tail_page, FLOG_PAGES - 1U);
+            if (!page_valid(p, &seq) || (seq != tail_seq - 1U)) break;
+            tail_page = p;
+            tail_seq  = seq;
+        }
+
+        // Up to the first free double word of the head page; a torn entry
+        // (bad header, or a blank one with data after it) closes the page
+        const uint8_t *pg = page_mem(head_page);
+        FLOG_Entry e;
+        uint32_t off = 8, next;
+        int8_t r;
+        while ((r = parse(pg, off, &e, &next, 1)) == 1) {
+            off = next;
+        }
+        if ((r < 0) || !blank(pg + off, FLOG_PAGE_LEN - off)) {
+            off = FLOG_PAGE_LEN;
+            stats.recovered++;
+        }
+        head_off = off;
+
+        // Spares, in case a reset came before their erase did
+        for (uint32_t k = 1; k <= FLOG_SPARE_PAGES; k++) {
+            uint32_t p = page_next(head_page, k);
+            if (!blank(page_mem(p), FLOG_PAGE_LEN)) erase_ahead(p);
+        }
+    }
+
+    kick();
+}
+
+uint8_t FLOG_Append(uint8_t type, const void *data, uint16_t len)
+{
+    uint32_t dws  = (len + 7U) / 8U;
+    uint32_t need = dws + 1U;
+    uint8_t  turn = (head_off + 8U * need > FLOG_PAGE_LEN);
+
+    if ((len == 0) || (len > FLOG_MAX_ENTRY) || (type == 0) || (type == 0xFF) ||
+        (q_free() < need + (turn ? 2U : 0U))) {
+        stats.dropped++;
+        return 0;
+    }
+
+    if (turn) open_page(page_next(head_page, 1));
+
+    uint32_t addr = FLOG_ADDR + head_page * FLOG_PAGE_LEN + head_off;
+    const uint8_t *src = data;
+
+    // Payload first, header last
+    for (uint32_t i = 0; i < dws; i++) {
+        uint64_t dw  = ~0ULL;
+        uint32_t cnt = len - 8U * i;
+        memcpy(&dw, src + 8U * i, (cnt < 8U) ? cnt : 8U);
+        q_push(FLOG_OP_PROGRAM, addr + 8U + 8U * i, dw);
+    }
+    last.seq = head_seq;
+    last.off = head_off;
+    q_push(FLOG_OP_COMMIT, addr,
+           len | ((uint64_t)type << 16) | ((uint64_t)hdr_check(len, type) << 24) |
+           ((uint64_t)CSUM_Crc32(0, data, len) << 32));
+
+    head_off += 8U * need;
+    stats.appended++;
+    kick();
+    return 1;
+}
+
+uint8_t FLOG_Busy(void)
+{
+    return q_head != q_tail;
+}
+
+void FLOG_LastAppended(FLOG_Iter *at)
+{
+    *at = last;
+}
+
+/* ======== Reading ======== */
+
+void FLOG_IterInit(FLOG_Iter *it)
+{
+    it->seq = tail_seq;
+    it->off = 8;
+}
+
+static uint8_t next_entry(FLOG_Iter *it, FLOG_Entry *e, uint8_t crc)
+{
+    uint32_t seq, next;
+    int8_t   r;
+
+    if ((int32_t)(it->seq - tail_seq) < 0) {
+        FLOG_IterInit(it);          // its page was erased under it
+    }
+
+    while ((int32_t)(head_seq - it->seq) >= 0) {
+        uint32_t p = page_next(tail_page, it->seq - tail_seq);
+
+        if (page_valid(p, &seq) && (seq == it->seq)) {
+            // Past a failed payload program; the header says how far
+            while ((r = parse(page_mem(p), it->off, e, &next, crc)) == -2) {
+                it->off = next;
+            }
+            if (r == 1) {
+                it->off = next;
+                return 1;
+            }
+        }
+        if (it->seq == head_seq) break;     // more may come
+        it->seq++;
+        it->off = 8;
+    }
+    return 0;
+}
+
+uint8_t FLOG_Next(FLOG_Iter *it, FLOG_Entry *e)
+{
+    return next_entry(it, e, 1);
+}
+
+uint8_t FLOG_Skim(FLOG_Iter *it, FLOG_Entry *e)
+{
+    return next_entry(it, e, 0);
+}
+
+uint32_t FLOG_Size(void)
+{
+    return (head_seq - tail_seq + 1U) * FLOG_PAGE_LEN;
+}
+
+uint32_t FLOG_Read(uint32_t offset, uint8_t *buf, uint32_t len)
+{
+    uint32_t size = FLOG_Size();
+    uint32_t done = 0;
+
+    while ((done < len) && (offset < size)) {
+        uint32_t off = offset % FLOG_PAGE_LEN;
+        uint32_t n   = FLOG_PAGE_LEN - off;
+        if (n > len - done) n = len - done;
+
+        memcpy(buf + done, page_mem(page_next(tail_page, offset / FLOG_PAGE_LEN)) + off, n);
+        done   += n;
+        offset += n;
+    }
+    return done;
+}
+
+void FLOG_GetStats(FLOG_Stats *s)
+{
+    *s = stats;
+    s->pages = head_seq - tail_seq + 1U;
+}
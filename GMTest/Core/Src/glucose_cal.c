@@ -0,0 +1,155 @@
+/*
+ * glucose_cal.c
+ *
+ *  Created on: Oct 17, 2026
+ *      Author: kings
+ */
+
+#include "glucose_cal.h"
+#include "checksum.h"
+#include "main.h"       // CMSIS DWT
+#include <stddef.h>
+
+/* Bench placeholder until the sensor lot is characterised: full scale of
+ * the potentiostat output reads 600 mg/dL, linear through zero.
+ */
+static const CAL_Record cal_default = {
+    .magic    = CAL_MAGIC,
+    .version  = CAL_VERSION,
+    .curve    = CAL_CURVE_PWL,
+    .npoints  = 2,
+    .offset   = 0,
+    .x        = { 0, 65535 },
+    .y        = { 0, 600 << 16 },
+    .temp_ref = 370,
+    .temp_coef = 0,
+};
+
+/* ======== Active calibration ======== */
+
+static CAL_Record cal;
+
+// Derived when a record is loaded, so CAL_Convert only multiplies
+static int32_t  slope[CAL_MAX_POINTS - 1];  // PWL segment slopes, Q24 per count
+static int16_t  temp_now;
+static int32_t  temp_gain = 1 << 16;        // 1 / temperature gain, Q16
+
+static CAL_Stats cal_stats;
+
+static uint32_t record_crc(const CAL_Record *rec)
+{
+    return CSUM_Crc32(0, rec, offsetof(CAL_Record, crc));
+}
+
+static void update_temp_gain(void)
+{
+    // Sensitivity grows by temp_coef per degC above temp_ref; divide it out
+    int64_t gain = (1 << 16) +
+                   (int64_t)cal.temp_coef * (temp_now - cal.temp_ref) / 10;
+    if (gain < (1 << 12)) gain = 1 << 12;   // keep within 16x either way
+    if (gain > (1 << 20)) gain = 1 << 20;
+    temp_gain = (int32_t)((1LL << 32) / gain);
+}
+
+/* ======== Public API ======== */
+
+void CAL_Init(void)
+{
+    CAL_Record rec = cal_default;
+
+    CAL_Seal(&rec);
+    temp_now = rec.temp_ref;
+    CAL_Load(&rec);
+}
+
+uint8_t CAL_Load(const CAL_Record *rec)
+{
+    if ((rec->magic != CAL_MAGIC) || (rec->version != CAL_VERSION) ||
+        (rec->crc != record_crc(rec))) {
+        return 0;
+    }
+
+    int32_t s[CAL_MAX_POINTS - 1];
+
+    if (rec->curve == CAL_CURVE_PWL) {
+        if ((rec->npoints < 2U) || (rec->npoints > CAL_MAX_POINTS)) return 0;
+
+        for (uint8_t i = 0; i + 1U < rec->npoints; i++) {
+            int32_t dx = (int32_t)rec->x[i + 1] - rec->x[i];
+            if (dx <= 0) return 0;
+
+            // Q16 rise over a count run, kept as Q24; must fit in 32 bits
+            int64_t q24 = ((int64_t)rec->y[i + 1] - rec->y[i]) * 256 / dx;
+            if ((q24 > INT32_MAX) || (q24 < INT32_MIN)) return 0;
+            s[i] = (int32_t)q24;
+        }
+    } else if (rec->curve == CAL_CURVE_POLY) {
+        if ((rec->npoints < 1U) || (rec->npoints > CAL_MAX_POINTS)) return 0;
+    } else {
+        return 0;
+    }
+
+    cal = *rec;
+    for (uint8_t i = 0; i + 1U < CAL_MAX_POINTS; i++) {
+        slope[i] = (rec->curve == CAL_CURVE_PWL) ? s[i] : 0;
+    }
+    update_temp_gain();
+    return 1;
+}
+
+const CAL_Record *CAL_Get(void)
+{
+    return &cal;
+}
+
+void CAL_Seal(CAL_Record *rec)
+{
+    rec->crc = record_crc(rec);
+}
+
+void CAL_SetTemperature(int16_t temp)
+{
+    temp_now = temp;
+    update_temp_gain();
+}
+
+int32_t CAL_Convert(uint16_t raw16)
+{
+    uint32_t start = DWT->CYCCNT;
+    int32_t x = (int32_t)raw16 - cal.offset;
+    int64_t y;      // steep or extrapolated curves can leave 32 bits
+
+    if (x < 0) x = 0;
+    if (x > 0xFFFF) x = 0xFFFF;
+
+    if (cal.curve == CAL_CURVE_PWL) {
+        // Last knot at or below x; the end segments extrapolate
+        uint8_t i = 0;
+        while ((i + 2U < cal.npoints) && (x >= cal.x[i + 1])) i++;
+
+        int64_t dy = (int64_t)slope[i] * (x - (int32_t)cal.x[i]);
+        y = cal.y[i] + ((dy + 0x80) >> 8);
+    } else {
+        // Horner in Q16 with u = x / 65536
+        int64_t acc = cal.y[cal.npoints - 1];
+        for (int8_t k = (int8_t)cal.npoints - 2; k >= 0; k--) {
+            acc = ((acc * x) >> 16) + cal.y[k];
+        }
+        y = acc;
+    }
+
+    y = (y * temp_gain) >> 16;
+    if (y < 0) y = 0;
+    if (y > INT32_MAX) y = INT32_MAX;
+
+    uint32_t cycles = DWT->CYCCNT - start;
+    cal_stats.conversions++;
+    cal_stats.last_cycles = cycles;
+    if (cycles > cal_stats.max_cycles) cal_stats.max_cycles = cycles;
+    return (int32_t)y;
+}
+
+void CAL_GetStats(CAL_Stats *stats)
+{
+    *stats = cal_stats;
+}
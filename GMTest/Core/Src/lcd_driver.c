@@ -7,37 +7,147 @@
 
 #include "lcd_driver.h"
 #include "GFX_STM32.h"    // text, cursor, font rendering
+#include "lcd_fb.h"
 #include <stdlib.h>
 
+static uint8_t fb_enabled = 0;
+static uint8_t fb_bypass = 0;       // LCD_SetDirect: straight to the panel
+
 void LCD_Init(void)
 {
     ILI9341_Init();
     GFX_Init();      // sets rotation, default font, etc.
+    GFX_SetFillRectFn(NULL);
 }
 
 void LCD_FillScreen(uint16_t color)
 {
-    ILI9341_FillScreen(color);
+    LCD_FillRect(0, 0, ILI9341_Width, ILI9341_Height, color);
 }
 
 void LCD_FillRect(uint16_t x, uint16_t y, uint16_t w, uint16_t h, uint16_t color)
 {
-    ILI9341_FillRect(x, y, w, h, color);
+    if (fb_enabled && !fb_bypass) {
+        LCD_FB_FillRect(x, y, w, h, color);
+    } else {
+        ILI9341_FillRect(x, y, w, h, color);
+    }
 }
 
 void LCD_DrawPixel(uint16_t x, uint16_t y, uint16_t color)
 {
-    ILI9341_DrawPixel(x, y, color);
+    LCD_FillRect(x, y, 1, 1, color);
 }
 
 void LCD_DrawFastVLine(uint16_t x, uint16_t y, uint16_t h, uint16_t color)
 {
-    ILI9341_DrawFastVLine(x, y, h, color);
+    LCD_FillRect(x, y, 1, h, color);
 }
 
 void LCD_DrawFastHLine(uint16_t x, uint16_t y, uint16_t w, uint16_t color)
 {
-    ILI9341_DrawFastHLine(x, y, w, color);
+    LCD_FillRect(x, y, w, 1, color);
+}
+
+/* Render callback, runs in the SPI IRQ. The job is one column; arg holds
+ * the lit rows relative to job->y, first in the high half, last in the low.
+ */
+static void column_render(const ILI9341_RenderJob *job, uint32_t first,
+                          uint16_t count, uint8_t *out)
+{
+    uint16_t lit0 = job->arg >> 16;
+    uint16_t lit1 = job->arg & 0xFFFF;
+
+    while (count--) {
+        uint16_t c = ((first >= lit0) && (first <= lit1)) ? job->fg : job->bg;
+        *out++ = c >> 8;
+        *out++ = c & 0xFF;
+        first++;
+    }
+}
+
+void LCD_DrawColumn(uint16_t x, uint16_t y, uint16_t h, uint16_t bg,
+                    uint16_t span_y0, uint16_t span_y1, uint16_t color)
+{
+    if ((x >= ILI9341_Width) || (y >= ILI9341_Height) || (h == 0)) return;
+    if (y + h > ILI9341_Height) h = ILI9341_Height - y;
+
+    if (span_y0 > span_y1) {
+        uint16_t t = span_y0;
+        span_y0 = span_y1;
+        span_y1 = t;
+    }
+    if (span_y0 < y) span_y0 = y;
+    if (span_y1 > y + h - 1) span_y1 = y + h - 1;
+
+    if (fb_enabled && !fb_bypass) {
+        LCD_FB_FillRect(x, y, 1, h, bg);
+        if (span_y0 <= span_y1) {
+            LCD_FB_FillRect(x, span_y0, 1, span_y1 - span_y0 + 1, color);
+        }
+        return;
+    }
+
+    ILI9341_RenderJob job = {
+        .x = x, .y = y, .w = 1, .h = h,
+        .fg = color, .bg = bg,
+        .src = NULL,
+        // an empty span (0xFFFF..0) lights nothing
+        .arg = (span_y0 <= span_y1) ?
+               (((uint32_t)(span_y0 - y) << 16) | (uint32_t)(span_y1 - y)) :
+               0xFFFF0000U,
+    };
+    ILI9341_DrawRendered(&job, column_render);
+}
+
+void LCD_SetScrollArea(uint16_t start, uint16_t len)
+{
+    ILI9341_SetScrollArea(start, len);
+}
+
+void LCD_ScrollTo(uint16_t offset)
+{
+    ILI9341_ScrollTo(offset);
+}
+
+void LCD_EnableFramebuffer(const uint16_t palette[4])
+{
+    LCD_FB_Init(palette);
+    fb_enabled = 1;
+    fb_bypass  = 0;
+    GFX_SetFillRectFn(LCD_FB_FillRect);
+}
+
+void LCD_SetDirectArea(uint16_t x, uint16_t y, uint16_t w, uint16_t h)
+{
+    if (fb_enabled) {
+        LCD_FB_SetDirectArea(x, y, w, h);
+    }
+}
+
+void LCD_SetDirect(uint8_t direct)
+{
+    if (!fb_enabled) return;
+
+    fb_bypass = direct;
+    GFX_SetFillRectFn(direct ? NULL : LCD_FB_FillRect);
+}
+
+void LCD_Flush(void)
+{
+    if (fb_enabled) {
+        LCD_FB_Flush();
+    }
+}
+
+uint8_t LCD_IsBusy(void)
+{
+    return ILI9341_IsBusy();
+}
+
+void LCD_GetQueueStats(ILI9341_QueueStats *stats)
+{
+    ILI9341_GetQueueStats(stats);
 }
 
 /* Text layer */
@@ -56,27 +166,62 @@ void LCD_SetTextColor(uint16_t color)
     GFX_SetTextColor(color);
 }
 
+void LCD_SetTextBgColor(uint16_t color)
+{
+    GFX_SetTextBgColor(color);
+}
+
+void LCD_SetDigitFont(const GFX_DigitFont *font)
+{
+    GFX_SetDigitFont(font);
+}
+
 void LCD_Print(const char *str)
 {
     GFX_PrintString(str);
 }
 
+/* Flush one run of line pixels as a single fill. The run starts at (x, y)
+ * and goes len pixels in the step direction along the run axis.
+ */
+static void line_run(int16_t x, int16_t y, int16_t len, uint8_t steep,
+                     int16_t sx, int16_t sy, uint16_t color)
+{
+    if (steep) {
+        LCD_FillRect(x, (sy > 0) ? y : (y - len + 1), 1, len, color);
+    } else {
+        LCD_FillRect((sx > 0) ? x : (x - len + 1), y, len, 1, color);
+    }
+}
+
 void LCD_DrawLine(uint16_t x0, uint16_t y0,
                   uint16_t x1, uint16_t y1,
                   uint16_t color)
 {
-    // Bresenham line (fast)
+    // Bresenham line (fast), with the pixels of each column (steep lines)
+    // or row (shallow lines) coalesced into one fill.
     int16_t dx = abs(x1 - x0), sx = x0 < x1 ? 1 : -1;
     int16_t dy = -abs(y1 - y0), sy = y0 < y1 ? 1 : -1;
     int16_t err = dx + dy, e2;
 
+    uint8_t steep = (-dy > dx);
+    int16_t rx = x0, ry = y0, len = 0;
+
     while (1) {
-        ILI9341_DrawPixel(x0, y0, color);
+        if (len && (steep ? (x0 != rx) : (y0 != ry))) {
+            line_run(rx, ry, len, steep, sx, sy, color);
+            len = 0;
+        }
+        if (!len) {
+            rx = x0;
+            ry = y0;
+        }
+        len++;
+
         if (x0 == x1 && y0 == y1) break;
         e2 = 2 * err;
         if (e2 >= dy) { err += dy; x0 += sx; }
         if (e2 <= dx) { err += dx; y0 += sy; }
     }
+    line_run(rx, ry, len, steep, sx, sy, color);
 }
-
-
@@ -0,0 +1,235 @@
+/*
+ * lcd_fb.c
+ *
+ *  Created on: Oct 17, 2026
+ *      Author: kings
+ */
+
+#include "lcd_fb.h"
+#include "ILI9341_STM32.h"
+#include <string.h>
+
+/* ======== Internal State ======== */
+
+/* 2 bits per pixel, 4 pixels per byte, leftmost pixel in the top bits */
+#define FB_STRIDE   (LCD_FB_W / 4)
+
+static uint8_t fb_pixels[LCD_FB_H][FB_STRIDE] __attribute__((section(".ram2")));
+
+/* One bit per tile column, one word per tile row */
+static uint16_t fb_dirty[LCD_FB_TILES_Y];
+
+static uint16_t fb_palette[LCD_FB_COLORS];
+static uint8_t  fb_pal_hi[LCD_FB_COLORS];
+static uint8_t  fb_pal_lo[LCD_FB_COLORS];
+
+/* Drawn straight to the panel, never flushed; w 0 when there is none */
+static ILI9341_RenderJob fb_direct;
+
+/* ======== Helpers ======== */
+
+/* Exact palette hit, otherwise the closest entry in RGB565 space */
+static uint8_t fb_color_index(uint16_t color)
+{
+    uint8_t  best = 0;
+    uint32_t best_dist = 0xFFFFFFFFU;
+
+    for (uint8_t i = 0; i < LCD_FB_COLORS; i++) {
+        if (fb_palette[i] == color) {
+            return i;
+        }
+
+        int32_t dr = (int32_t)(color >> 11)          - (fb_palette[i] >> 11);
+        int32_t dg = (int32_t)((color >> 5) & 0x3F)  - ((fb_palette[i] >> 5) & 0x3F);
+        int32_t db = (int32_t)(color & 0x1F)         - (fb_palette[i] & 0x1F);
+        uint32_t dist = (uint32_t)(4 * dr * dr + dg * dg + 4 * db * db);
+
+        if (dist < best_dist) {
+            best_dist = dist;
+            best = i;
+        }
+    }
+    return best;
+}
+
+static void fb_mark_dirty(uint16_t x, uint16_t y, uint16_t w, uint16_t h)
+{
+    uint8_t tx0 = x / LCD_FB_TILE_W;
+    uint8_t tx1 = (x + w - 1) / LCD_FB_TILE_W;
+    uint8_t ty0 = y / LCD_FB_TILE_H;
+    uint8_t ty1 = (y + h - 1) / LCD_FB_TILE_H;
+
+    uint16_t mask = (uint16_t)(((1U << (tx1 + 1)) - 1U) & ~((1U << tx0) - 1U));
+
+    for (uint8_t ty = ty0; ty <= ty1; ty++) {
+        fb_dirty[ty] |= mask;
+    }
+}
+
+/* Render callback, runs in the SPI IRQ: expand indexed pixels to RGB565 */
+static void fb_render(const ILI9341_RenderJob *job, uint32_t first,
+                      uint16_t count, uint8_t *out)
+{
+    uint16_t row = (uint16_t)(first / job->w);
+    uint16_t col = (uint16_t)(first % job->w);
+
+    const uint8_t *src = fb_pixels[job->y + row];
+
+    while (count--) {
+        uint16_t x = job->x + col;
+        uint8_t  c = (src[x >> 2] >> (6 - 2 * (x & 3))) & 0x03;
+
+        *out++ = fb_pal_hi[c];
+        *out++ = fb_pal_lo[c];
+
+        if (++col == job->w) {
+            col = 0;
+            row++;
+            src = fb_pixels[job->y + row];
+        }
+    }
+}
+
+/* Queue one dirty region less the direct area: up to four windows, the
+ * bands above and below it and the pieces either side
+ */
+static uint16_t fb_queue(const ILI9341_RenderJob *job)
+{
+    const ILI9341_RenderJob *d = &fb_direct;
+
+    if ((d->w == 0) ||
+        (d->x >= job->x + job->w) || (d->x + d->w <= job->x) ||
+        (d->y >= job->y + job->h) || (d->y + d->h <= job->y)) {
+        ILI9341_DrawRendered(job, fb_render);
+        return 1;
+    }
+
+    uint16_t x0 = (d->x > job->x) ? d->x : job->x;
+    uint16_t y0 = (d->y > job->y) ? d->y : job->y;
+    uint16_t x1 = (d->x + d->w < job->x + job->w) ? d->x + d->w : job->x + job->w;
+    uint16_t y1 = (d->y + d->h < job->y + job->h) ? d->y + d->h : job->y + job->h;
+
+    const ILI9341_RenderJob parts[4] = {
+        { .x = job->x, .y = job->y, .w = job->w, .h = y0 - job->y },
+        { .x = job->x, .y = y1,     .w = job->w, .h = job->y + job->h - y1 },
+        { .x = job->x, .y = y0,     .w = x0 - job->x, .h = y1 - y0 },
+        { .x = x1,     .y = y0,     .w = job->x + job->w - x1, .h = y1 - y0 },
+    };
+    uint16_t rects = 0;
+
+    for (uint8_t i = 0; i < 4; i++) {
+        if ((parts[i].w > 0) && (parts[i].h > 0)) {
+            ILI9341_DrawRendered(&parts[i], fb_render);
+            rects++;
+        }
+    }
+    return rects;
+}
+
+/* ======== API Functions ======== */
+
+void LCD_FB_Init(const uint16_t palette[LCD_FB_COLORS])
+{
+    for (uint8_t i = 0; i < LCD_FB_COLORS; i++) {
+        fb_palette[i] = palette[i];
+        fb_pal_hi[i]  = palette[i] >> 8;
+        fb_pal_lo[i]  = palette[i] & 0xFF;
+    }
+
+    /* RAM2 is NOLOAD: start from palette entry 0 everywhere */
+    memset(fb_pixels, 0, sizeof(fb_pixels));
+    fb_mark_dirty(0, 0, LCD_FB_W, LCD_FB_H);
+    fb_direct.w = 0;
+}
+
+void LCD_FB_SetDirectArea(uint16_t x, uint16_t y, uint16_t w, uint16_t h)
+{
+    if ((x >= LCD_FB_W) || (y >= LCD_FB_H)) w = 0;
+    if (x + w > LCD_FB_W) w = LCD_FB_W - x;
+    if (y + h > LCD_FB_H) h = LCD_FB_H - y;
+
+    fb_direct = (ILI9341_RenderJob){
+        .x = x, .y = y, .w = (h > 0) ? w : 0, .h = h,
+    };
+}
+
+void LCD_FB_FillRect(uint16_t x, uint16_t y, uint16_t w, uint16_t h,
+                     uint16_t color)
+{
+    if ((x >= LCD_FB_W) || (y >= LCD_FB_H)) return;
+    if ((w == 0) || (h == 0)) return;
+
+    if (x + w > LCD_FB_W) w = LCD_FB_W - x;
+    if (y + h > LCD_FB_H) h = LCD_FB_H - y;
+
+    uint8_t c    = fb_color_index(color);
+    uint8_t fill = c * 0x55;            // same index in all four slots
+
+    uint16_t x_end = x + w;             // exclusive
+    uint16_t head  = x;                 // first whole byte starts here
+    while ((head & 3) && (head < x_end)) head++;
+    uint16_t tail  = x_end & ~3U;       // last whole byte ends here
+    if (tail < head) tail = head;
+
+    for (uint16_t row = y; row < y + h; row++) {
+        uint8_t *line = fb_pixels[row];
+
+        for (uint16_t px = x; px < head; px++) {
+            uint8_t shift = 6 - 2 * (px & 3);
+            line[px >> 2] = (line[px >> 2] & ~(0x03 << shift)) | (c << shift);
+        }
+        if (tail > head) {
+            memset(&line[head >> 2], fill, (tail - head) >> 2);
+        }
+        for (uint16_t px = (tail > head) ? tail : head; px < x_end; px++) {
+            uint8_t shift = 6 - 2 * (px & 3);
+            line[px >> 2] = (line[px >> 2] & ~(0x03 << shift)) | (c << shift);
+        }
+    }
+
+    fb_mark_dirty(x, y, w, h);
+}
+
+void LCD_FB_DrawPixel(uint16_t x, uint16_t y, uint16_t color)
+{
+    LCD_FB_FillRect(x, y, 1, 1, color);
+}
+
+uint16_t LCD_FB_Flush(void)
+{
+    uint16_t rects = 0;
+
+    for (uint8_t ty = 0; ty < LCD_FB_TILES_Y; ty++) {
+        while (fb_dirty[ty]) {
+            /* Widest run of dirty tiles starting at the first dirty one */
+            uint8_t tx0 = 0;
+            while (!(fb_dirty[ty] & (1U << tx0))) tx0++;
+            uint8_t tx1 = tx0;
+            while ((tx1 + 1 < LCD_FB_TILES_X) &&
+                   (fb_dirty[ty] & (1U << (tx1 + 1)))) {
+                tx1++;
+            }
+            uint16_t mask = (uint16_t)(((1U << (tx1 + 1)) - 1U) & ~((1U << tx0) - 1U));
+
+            /* Grow downwards while the rows below cover the same run */
+            uint8_t ty1 = ty;
+            while ((ty1 + 1 < LCD_FB_TILES_Y) &&
+                   ((fb_dirty[ty1 + 1] & mask) == mask)) {
+                ty1++;
+            }
+            for (uint8_t t = ty; t <= ty1; t++) {
+                fb_dirty[t] &= ~mask;
+            }
+
+            ILI9341_RenderJob job = {
+                .x = tx0 * LCD_FB_TILE_W,
+                .y = ty * LCD_FB_TILE_H,
+                .w = (tx1 - tx0 + 1) * LCD_FB_TILE_W,
+                .h = (ty1 - ty + 1) * LCD_FB_TILE_H,
+            };
+            rects += fb_queue(&job);
+        }
+    }
+
+    return rects;
+}
@@ -22,13 +22,50 @@
 #define SCREEN_W   320
 #define SCREEN_H   240
 
+// Scrolling trend: the graph moves left in hardware (VSCRSADD) and each
+// sample costs one column write. Set to 0 for the wrap-around sweep.
+#ifndef LCD_UI_SCROLL_TREND
+#define LCD_UI_SCROLL_TREND  0
+#endif
+
+#if LCD_UI_SCROLL_TREND
+// Layout: readout in a fixed panel on the left, graph scrolling to its right.
+// In landscape the panel scrolls along screen x, so the fixed areas can only
+// be vertical bands; a top band would scroll with the graph.
+#define PANEL_W    120
+#define PANEL_H    (SCREEN_H)
+#define GRAPH_X    (PANEL_W)
+#define GRAPH_Y    0
+#define GRAPH_W    (SCREEN_W - PANEL_W)      // 200 px
+#define GRAPH_H    (SCREEN_H)
+#define TREND_X    8                         // "Trend" label sits in the panel
+#define TREND_Y    (SCREEN_H - 24)
+#define PANEL_CLEAR_W  (PANEL_W - 1)         // keep the divider
+#define LABEL_SIZE 1                         // 6 px per char fits the panel
+#else
 // Layout: top 1/4 for current value, bottom 3/4 for graph.
 #define TOP_H      (SCREEN_H / 4)            // 60 px
+#define PANEL_W    (SCREEN_W)
+#define PANEL_H    (TOP_H)
+#define GRAPH_X    0
 #define GRAPH_Y    (TOP_H)
+#define GRAPH_W    (SCREEN_W)
 #define GRAPH_H    (SCREEN_H - TOP_H)        // 180 px
+#define TREND_X    8
+#define TREND_Y    (GRAPH_Y + 4)
+#define PANEL_CLEAR_W  (PANEL_W)
+#define LABEL_SIZE 2
+#endif
 
 // Graph resolution: one data point per horizontal pixel.
-#define GRAPH_POINTS   (SCREEN_W)
+#define GRAPH_POINTS   (GRAPH_W)
+
+// Default time between LCD_UI_AddSample() calls, one ADC block
+// (ACQ_BLOCK_MS); LCD_UI_SetSamplePeriod() changes it. Used to size the
+// trend window buckets.
+#ifndef LCD_UI_SAMPLE_PERIOD_MS
+#define LCD_UI_SAMPLE_PERIOD_MS  500U
+#endif
 
 // ADC range for mapping (adjust if you change resolution).
 #define ADC_MAX        4095U
@@ -61,16 +98,77 @@
 #define GRAPH_AXIS_COLOR   LCD_COLOR_WHITE
 #define GRAPH_TRACE_COLOR  LCD_COLOR_GREEN
 
+// Numeric readout: pre-rendered 24x32 digits under the size-2 label.
+#define VALUE_X            8
+#define VALUE_Y            26
+#define VALUE_FONT         GFX_Digits24x32
+#define VALUE_CELLS        5                 // "65535"
+
+// Join consecutive samples with a line instead of plotting separate dots.
+// Either way each sample is one column window.
+#ifndef LCD_UI_TREND_LINE
+#define LCD_UI_TREND_LINE  1
+#endif
+
+// Draw into the RAM2 tile framebuffer and send only changed tiles on
+// LCD_UI_Flush(). Set to 0 to draw straight to the panel. Off by default
+// when scrolling: a one-pixel column would go out as a 32-pixel tile strip.
+// The readout bypasses it either way, to keep its anti-aliased edges.
+#ifndef LCD_UI_USE_FRAMEBUFFER
+#define LCD_UI_USE_FRAMEBUFFER  (!LCD_UI_SCROLL_TREND)
+#endif
+
+#if LCD_UI_USE_FRAMEBUFFER
+// The framebuffer holds four colors; these are the ones the layout uses.
+static const uint16_t ui_palette[4] = {
+    GRAPH_BG_COLOR, TOP_BG_COLOR, TOP_TEXT_COLOR, GRAPH_TRACE_COLOR
+};
+#endif
+
 // -----------------------------------------------------------------------------
 //  Internal state
 // -----------------------------------------------------------------------------
 
-static uint16_t graph_y[GRAPH_POINTS];
-static uint16_t graph_index = 0;
+// Trend history, one level per time window. Each level is a ring of
+// per-column min/max buckets of raw ADC values; ring slot i is drawn in
+// graph column i. The bucket being filled lives in slot `head`, so every
+// level is updated in O(1) per sample and any window can be redrawn from
+// its ring without going back to raw data.
+typedef struct {
+    uint16_t per_bucket;                // samples folded into one column
+    uint16_t reps;                      // columns per sample (per_bucket 1)
+    uint16_t count;                     // samples in the open bucket, 0 = none
+    uint16_t head;                      // slot of the open (or next) bucket
+    uint16_t filled;                    // slots holding data
+    uint16_t lo[GRAPH_POINTS];
+    uint16_t hi[GRAPH_POINTS];
+} trend_level_t;
+
+// Shortest span each window covers. Buckets are whole samples, so a window
+// can be longer than asked for when the sample period does not divide it.
+// Samples sparser than one per column take several columns each (at 5 s
+// per sample on a 200 px graph, "5 min" is 3 columns per sample, 5.5 min).
+static const uint32_t trend_window_s[LCD_UI_TREND_COUNT] = {
+    5U * 60U,           // LCD_UI_TREND_5MIN
+    60U * 60U,          // LCD_UI_TREND_1H
+    8U * 60U * 60U,     // LCD_UI_TREND_8H
+};
+
+static trend_level_t trend[LCD_UI_TREND_COUNT];
+static LCD_UI_TrendWindow trend_sel = LCD_UI_TREND_5MIN;
 static uint8_t  graph_initialized = 0;
+static uint32_t sample_period_ms = LCD_UI_SAMPLE_PERIOD_MS;
+
+#if LCD_UI_SCROLL_TREND
+static uint8_t  scroll_pending = 0;     // new column queued, scroll on flush
+static uint16_t scroll_offset = 0;      // offset to scroll to on flush
+#endif
 
 static char current_label[32] = "ADC Value";
 
+// Readout as last drawn; only cells that differ from it are redrawn.
+static char value_text[8] = "";
+
 // -----------------------------------------------------------------------------
 //  Internal helper functions
 // -----------------------------------------------------------------------------
@@ -105,29 +203,38 @@ static uint16_t map_to_graph_y(uint16_t adc_val)
  */
 static void draw_static_layout(void)
 {
-    // Draw top background.
-    LCD_FillRect(0, 0, SCREEN_W, TOP_H, TOP_BG_COLOR);
+    // Draw top (or side) panel background.
+    LCD_FillRect(0, 0, PANEL_W, PANEL_H, TOP_BG_COLOR);
 
     // Draw graph background.
-    LCD_FillRect(0, GRAPH_Y, SCREEN_W, GRAPH_H, GRAPH_BG_COLOR);
+    LCD_FillRect(GRAPH_X, GRAPH_Y, GRAPH_W, GRAPH_H, GRAPH_BG_COLOR);
 
+#if LCD_UI_SCROLL_TREND
+    // Divider line between panel and graph areas.
+    LCD_DrawFastVLine(PANEL_W - 1, 0, PANEL_H, LCD_COLOR_WHITE);
+#else
     // Divider line between top and graph areas.
     LCD_DrawLine(0, TOP_H, SCREEN_W, TOP_H, LCD_COLOR_WHITE);
+#endif
 
     // Label for current reading.
     LCD_SetCursor(8, 8);
-    LCD_SetTextSize(2);
+    LCD_SetTextSize(LABEL_SIZE);
     LCD_SetTextColor(TOP_TEXT_COLOR);
+    LCD_SetTextBgColor(TOP_BG_COLOR);
     LCD_Print(current_label);
 
     // Label for graph.
-    LCD_SetCursor(8, GRAPH_Y + 4);
+    LCD_SetCursor(TREND_X, TREND_Y);
     LCD_SetTextSize(2);
     LCD_SetTextColor(LCD_COLOR_WHITE);
+    LCD_SetTextBgColor(LCD_UI_SCROLL_TREND ? TOP_BG_COLOR : GRAPH_BG_COLOR);
     LCD_Print("Trend");
 
+#if !LCD_UI_SCROLL_TREND
     // Optional: Draw a simple vertical "Y-axis" at left side of graph area.
     LCD_DrawFastVLine(0, GRAPH_Y, GRAPH_H, GRAPH_AXIS_COLOR);
+#endif
 }
 
 /**
@@ -136,7 +243,119 @@ static void draw_static_layout(void)
 static void draw_graph_axes(void)
 {
     // Horizontal baseline at bottom of graph.
-    LCD_DrawLine(0, GRAPH_Y + GRAPH_H - 1, SCREEN_W, GRAPH_Y + GRAPH_H - 1, GRAPH_AXIS_COLOR);
+    LCD_DrawFastHLine(GRAPH_X, GRAPH_Y + GRAPH_H - 1, GRAPH_W, GRAPH_AXIS_COLOR);
+}
+
+/**
+ * @brief Empty every trend level and size its buckets for its window.
+ */
+static void reset_trend(void)
+{
+    for (uint8_t i = 0; i < LCD_UI_TREND_COUNT; ++i) {
+        trend_level_t *lv = &trend[i];
+        uint32_t per = (trend_window_s[i] * 1000U +
+                        GRAPH_POINTS * sample_period_ms - 1U) /
+                       (GRAPH_POINTS * sample_period_ms);
+        uint32_t reps = GRAPH_POINTS * sample_period_ms /
+                        (trend_window_s[i] * 1000U);
+
+        lv->per_bucket = (per > 0U) ? (uint16_t)per : 1U;
+        lv->reps       = (reps > 0U) ? (uint16_t)reps : 1U;
+        lv->count  = 0;
+        lv->head   = 0;
+        lv->filled = 0;
+    }
+}
+
+/**
+ * @brief Fold one sample into a level's open bucket.
+ *
+ * @return 1 if the sample opened a new bucket (the graph gains a column).
+ */
+static uint8_t trend_add(trend_level_t *lv, uint16_t v)
+{
+    uint8_t opened = (lv->count == 0U);
+
+    if (opened) {
+        lv->lo[lv->head] = v;
+        lv->hi[lv->head] = v;
+        if (lv->filled < GRAPH_POINTS) {
+            lv->filled++;
+        }
+    } else {
+        if (v < lv->lo[lv->head]) lv->lo[lv->head] = v;
+        if (v > lv->hi[lv->head]) lv->hi[lv->head] = v;
+    }
+
+    if (++lv->count >= lv->per_bucket) {
+        lv->count = 0;
+        lv->head = (lv->head + 1U) % GRAPH_POINTS;
+    }
+    return opened;
+}
+
+/**
+ * @brief Draw ring slot `i` of a level as its graph column.
+ *
+ * The bucket's min..max is one span; with LCD_UI_TREND_LINE it is stretched
+ * to meet the previous column's span so the trace stays connected. One
+ * column window either way, 3 px thick for readability.
+ */
+static void draw_trend_column(const trend_level_t *lv, uint16_t i)
+{
+    uint16_t x = GRAPH_X + i;
+
+    if (i >= lv->filled) {
+        LCD_DrawFastVLine(x, GRAPH_Y, GRAPH_H - 1U, GRAPH_BG_COLOR);
+        return;
+    }
+
+    // Higher values are drawn higher up, so max gives the top row.
+    int32_t top = map_to_graph_y(lv->hi[i]);
+    int32_t bot = map_to_graph_y(lv->lo[i]);
+
+#if LCD_UI_TREND_LINE
+    // The oldest column is not joined to the open bucket behind it.
+    uint16_t prev = (i == 0U) ? (GRAPH_POINTS - 1U) : (i - 1U);
+    if ((prev < lv->filled) && (prev != lv->head || lv->count == 0U)) {
+        int32_t prev_top = map_to_graph_y(lv->hi[prev]);
+        int32_t prev_bot = map_to_graph_y(lv->lo[prev]);
+
+        if (prev_bot < top) top = prev_bot + 1;
+        if (prev_top > bot) bot = prev_top - 1;
+    }
+#endif
+
+    top -= 1;
+    bot += 1;
+    if (top < GRAPH_Y) top = GRAPH_Y;
+
+    LCD_DrawColumn(x, GRAPH_Y, GRAPH_H - 1U, GRAPH_BG_COLOR,
+                   (uint16_t)top, (uint16_t)bot, GRAPH_TRACE_COLOR);
+}
+
+/**
+ * @brief Slot holding the newest data of a level (its open bucket, or the
+ *        last closed one between buckets).
+ */
+static uint16_t trend_newest(const trend_level_t *lv)
+{
+    if (lv->count) {
+        return lv->head;
+    }
+    return (lv->head == 0U) ? (GRAPH_POINTS - 1U) : (lv->head - 1U);
+}
+
+/**
+ * @brief Put the graph back at its unscrolled position.
+ */
+static void reset_scroll(void)
+{
+#if LCD_UI_SCROLL_TREND
+    // Only the graph band scrolls; the panel is a fixed area.
+    LCD_SetScrollArea(GRAPH_X, GRAPH_W);
+    scroll_pending = 0;
+#endif
 }
 
 // -----------------------------------------------------------------------------
@@ -148,18 +367,30 @@ void LCD_UI_Init(void)
     // Low-level LCD init (provided by your driver).
     LCD_Init();
 
+#if LCD_UI_USE_FRAMEBUFFER
+    LCD_EnableFramebuffer(ui_palette);
+#endif
+
     // Clear screen and setup layout.
     LCD_FillScreen(LCD_COLOR_BLACK);
     draw_static_layout();
     draw_graph_axes();
+    reset_scroll();
 
-    // Initialize the graph buffer to midline.
-    uint16_t mid_y = map_to_graph_y(ADC_MAX / 2U);
-    for (uint16_t i = 0; i < GRAPH_POINTS; ++i) {
-        graph_y[i] = mid_y;
-    }
-    graph_index = 0;
+    // The layout cleared the readout.
+    value_text[0] = '\0';
+
+    // Start with empty trend history.
+    reset_trend();
     graph_initialized = 1;
+
+    LCD_UI_Flush();
+
+    // The readout goes straight to the panel from now on (its anti-aliased
+    // edges need more than the framebuffer's four colors); the flush above
+    // has cleared its area.
+    LCD_SetDirectArea(VALUE_X, VALUE_Y, VALUE_CELLS * VALUE_FONT.w,
+                      VALUE_FONT.h);
 }
 
 void LCD_UI_SetLabel(const char *label)
@@ -172,59 +403,132 @@ void LCD_UI_SetLabel(const char *label)
     strncpy(current_label, label, sizeof(current_label) - 1U);
     current_label[sizeof(current_label) - 1U] = '\0';
 
-    // Redraw the top region label.
-    LCD_FillRect(0, 0, SCREEN_W, TOP_H, TOP_BG_COLOR);
+    // Redraw the label line.
+    LCD_FillRect(0, 0, PANEL_CLEAR_W, 24, TOP_BG_COLOR);
 
     LCD_SetCursor(8, 8);
-    LCD_SetTextSize(2);
+    LCD_SetTextSize(LABEL_SIZE);
     LCD_SetTextColor(TOP_TEXT_COLOR);
+    LCD_SetTextBgColor(TOP_BG_COLOR);
     LCD_Print(current_label);
+
+    LCD_UI_Flush();
+}
+
+void LCD_UI_Flush(void)
+{
+    LCD_Flush();
+
+#if LCD_UI_SCROLL_TREND
+    // Scroll only once the new column is on its way, so it never shows a
+    // stale column at the right edge.
+    if (scroll_pending) {
+        LCD_ScrollTo(scroll_offset);
+        scroll_pending = 0;
+    }
+#endif
 }
 
 /**
  * @brief Update the numeric display at the top of the screen.
- *        This clears only the numeric line, not the whole top region.
+ *
+ * Compares against the string drawn last time and rewrites only the
+ * character cells that changed, each as one opaque glyph (120 -> 121 is a
+ * single 24x32 cell). Cells past the end of a shorter value are blanked.
  */
 void LCD_UI_UpdateCurrentValue(uint16_t raw_value)
 {
-    char buf[32];
+    char buf[sizeof(value_text)];
+    char cell[2] = { 0, 0 };
 
-    // Clear numeric area only (below the label).
-    // Adjust Y/height if you change font sizes.
-    LCD_FillRect(0, 36, SCREEN_W, TOP_H - 36, TOP_BG_COLOR);
+    snprintf(buf, sizeof(buf), "%u", raw_value);
+
+    size_t new_len = strlen(buf);
+    size_t old_len = strlen(value_text);
+    size_t cells   = (new_len > old_len) ? new_len : old_len;
 
-    // Big numeric value.
-    LCD_SetCursor(8, 40);
-    LCD_SetTextSize(4);
+    // Big numeric value, blitted straight from the flash glyphs to the
+    // panel, past the framebuffer.
     LCD_SetTextColor(TOP_TEXT_COLOR);
+    LCD_SetTextBgColor(TOP_BG_COLOR);
+    LCD_SetDigitFont(&VALUE_FONT);
+    LCD_SetDirect(1);
+
+    for (size_t i = 0; i < cells; ++i) {
+        char c = (i < new_len) ? buf[i] : ' ';
+        char o = (i < old_len) ? value_text[i] : ' ';
+        if (c == o) {
+            continue;
+        }
 
-    snprintf(buf, sizeof(buf), "%u", raw_value);
-    LCD_Print(buf);
+        cell[0] = c;
+        LCD_SetCursor(VALUE_X + i * VALUE_FONT.w, VALUE_Y);
+        LCD_Print(cell);
+    }
+
+    LCD_SetDirect(0);
+    LCD_SetDigitFont(NULL);
+
+    memcpy(value_text, buf, new_len + 1U);
 }
 
 void LCD_UI_ClearGraph(void)
 {
     // Clear the graph area visually.
-    LCD_FillRect(0, GRAPH_Y, SCREEN_W, GRAPH_H, GRAPH_BG_COLOR);
+    LCD_FillRect(GRAPH_X, GRAPH_Y, GRAPH_W, GRAPH_H, GRAPH_BG_COLOR);
 
     // Redraw axes/baseline.
     draw_graph_axes();
+    reset_scroll();
+
+    // Drop the history of every window.
+    reset_trend();
+    graph_initialized = 1;
+}
 
-    // Reset buffer to midline.
-    uint16_t mid_y = map_to_graph_y(ADC_MAX / 2U);
+void LCD_UI_SetSamplePeriod(uint32_t period_ms)
+{
+    if ((period_ms == 0U) || (period_ms == sample_period_ms)) {
+        return;
+    }
+    sample_period_ms = period_ms;
+
+    // Buckets sized for the old period would mislabel the windows.
+    LCD_UI_ClearGraph();
+}
+
+void LCD_UI_SetTrendWindow(LCD_UI_TrendWindow window)
+{
+    if (window >= LCD_UI_TREND_COUNT) {
+        return;
+    }
+    trend_sel = window;
+
+    // Redraw every column from the selected level's buckets.
+    const trend_level_t *lv = &trend[trend_sel];
     for (uint16_t i = 0; i < GRAPH_POINTS; ++i) {
-        graph_y[i] = mid_y;
+        draw_trend_column(lv, i);
     }
-    graph_index = 0;
-    graph_initialized = 1;
+
+#if LCD_UI_SCROLL_TREND
+    // Newest column at the right edge.
+    scroll_offset  = lv->filled ? ((trend_newest(lv) + 1U) % GRAPH_POINTS) : 0U;
+    scroll_pending = 1;
+#endif
 }
 
 /**
  * @brief Add a new sample and update the graph visually.
  *
- * This uses a circular buffer and draws a small vertical "dot" column
- * at the current X position. It erases only that column to keep SPI
- * bandwidth low.
+ * The sample goes into every trend level. On the selected one, its bucket's
+ * column is redrawn: the min/max span, joined to the previous column, or
+ * a small vertical "dot" with LCD_UI_TREND_LINE = 0 and one sample per
+ * bucket. That column is the only thing written, as a single window, to
+ * keep SPI bandwidth low.
+ *
+ * In scrolling mode a new bucket's column is written where the oldest one
+ * was and LCD_UI_Flush() then scrolls it in at the right edge: ring slot i
+ * is always drawn at graph column i.
  */
 void LCD_UI_AddSample(uint16_t raw_value)
 {
@@ -233,34 +537,26 @@ void LCD_UI_AddSample(uint16_t raw_value)
         LCD_UI_ClearGraph();
     }
 
-    uint16_t x = graph_index;
-    uint16_t y = map_to_graph_y(raw_value);
-
-    graph_y[x] = y;
-
-    // Erase this column in the graph area.
-    LCD_DrawFastVLine(x, GRAPH_Y, GRAPH_H, GRAPH_BG_COLOR);
-
-    // Draw a small 3-pixel vertical "dot" centered at y for readability.
-    for (int8_t dy = -1; dy <= 1; ++dy) {
-        int16_t yy = (int16_t)y + dy;
-        if ((yy >= GRAPH_Y) && (yy < (GRAPH_Y + GRAPH_H))) {
-            LCD_DrawPixel(x, yy, GRAPH_TRACE_COLOR);
+    raw_value = clamp_u16(raw_value, ADC_MAX);
+
+    uint8_t opened = 0;
+    for (uint8_t i = 0; i < LCD_UI_TREND_COUNT; ++i) {
+        trend_level_t *lv = &trend[i];
+        for (uint16_t r = 0; r < lv->reps; ++r) {
+            uint8_t o = trend_add(lv, raw_value);
+            if (i == trend_sel) {
+                opened |= o;
+                draw_trend_column(lv, trend_newest(lv));
+            }
         }
     }
 
-    // Optionally connect to previous sample (uncomment if you want a line graph).
-    /*
-    uint16_t prev_index = (x == 0U) ? (GRAPH_POINTS - 1U) : (x - 1U);
-    uint16_t prev_y = graph_y[prev_index];
-    LCD_DrawLine(prev_index, prev_y, x, y, GRAPH_TRACE_COLOR);
-    */
-
-    // Advance circular index.
-    graph_index++;
-    if (graph_index >= GRAPH_POINTS) {
-        graph_index = 0;
+#if LCD_UI_SCROLL_TREND
+    if (opened) {
+        scroll_offset  = (trend_newest(&trend[trend_sel]) + 1U) % GRAPH_POINTS;
+        scroll_pending = 1;
     }
+#else
+    (void)opened;
+#endif
 }
-
-
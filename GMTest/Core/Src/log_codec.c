@@ -0,0 +1,211 @@
+/*
+ * log_codec.c
+ *
+ *  Created on: Oct 17, 2026
+ *      Author: kings
+ */
+
+#include "log_codec.h"
+#include <string.h>
+
+_Static_assert(LOGC_MAX_SAMPLES <= 255U, "count is a byte");
+
+static void put16(uint8_t *p, uint16_t v)
+{
+    p[0] = v & 0xFF;
+    p[1] = v >> 8;
+}
+
+static void put32(uint8_t *p, uint32_t v)
+{
+    p[0] = v & 0xFF;
+    p[1] = (v >> 8) & 0xFF;
+    p[2] = (v >> 16) & 0xFF;
+    p[3] = v >> 24;
+}
+
+static uint16_t get16(const uint8_t *p)
+{
+    return p[0] | (p[1] << 8);
+}
+
+static uint32_t get32(const uint8_t *p)
+{
+    return p[0] | (p[1] << 8) | (p[2] << 16) | ((uint32_t)p[3] << 24);
+}
+
+/* ======== Encoder ======== */
+
+void LOGC_Init(LOGC_Encoder *enc, LOGC_BlockSink sink)
+{
+    memset(enc, 0, sizeof(*enc));
+    enc->sink = sink;
+}
+
+void LOGC_Flush(LOGC_Encoder *enc)
+{
+    uint8_t  block[LOGC_MAX_BLOCK];
+    uint8_t *p = &block[LOGC_HEADER_LEN];
+    uint32_t n = enc->count - 1U;
+    uint8_t  width = 0;
+
+    if (enc->count == 0U) return;
+
+    while ((enc->zz_or >> width) != 0U) {
+        width++;
+    }
+    if (enc->varint_len < (n * width + 7U) / 8U) {
+        width = LOGC_VARINT;
+    }
+
+    put32(&block[0], enc->key.tick);
+    put16(&block[4], enc->key.value);
+    put16(&block[6], enc->period);
+    put16(&block[8], enc->key.flags);
+    block[10] = enc->count;
+    block[11] = width;
+
+    if (width == LOGC_VARINT) {
+        for (uint32_t i = 0; i < n; i++) {
+            uint16_t z = enc->zz[i];
+            while (z >= 0x80U) {
+                *p++ = (z & 0x7FU) | 0x80U;
+                z >>= 7;
+            }
+            *p++ = (uint8_t)z;
+        }
+    } else if (width > 0U) {
+        uint32_t acc = 0;
+        uint8_t  bits = 0;
+        for (uint32_t i = 0; i < n; i++) {
+            acc |= (uint32_t)enc->zz[i] << bits;
+            bits += width;
+            while (bits >= 8U) {
+                *p++ = acc & 0xFF;
+                acc >>= 8;
+                bits -= 8U;
+            }
+        }
+        if (bits > 0U) *p++ = acc & 0xFF;
+    }
+
+    uint16_t len = (uint16_t)(p - block);
+    enc->count = 0;
+    enc->stats.blocks++;
+    enc->stats.bytes += len;
+    enc->sink(block, len);
+}
+
+void LOGC_Add(LOGC_Encoder *enc, uint32_t tick, uint16_t value, uint16_t flags)
+{
+    if (enc->count > 0U) {
+        uint32_t dt = tick - enc->key.tick;
+        uint8_t  fits = (flags == enc->key.flags) && (enc->count < LOGC_MAX_SAMPLES) &&
+                        (dt < LOGC_BLOCK_MS);
+
+        if (fits && (enc->count == 1U)) {
+            fits = (dt > 0U) && (dt <= 0xFFFFU);
+            enc->period = (uint16_t)dt;
+        } else if (fits) {
+            fits = (dt == (uint32_t)enc->count * enc->period);
+        }
+        if (!fits) LOGC_Flush(enc);
+    }
+
+    enc->stats.samples++;
+
+    if (enc->count == 0U) {
+        enc->key = (LOGC_Sample){ .tick = tick, .value = value, .flags = flags };
+        enc->prev = value;
+        enc->period = 0;
+        enc->count = 1;
+        enc->zz_or = 0;
+        enc->varint_len = 0;
+        return;
+    }
+
+    int16_t  d = (int16_t)(uint16_t)(value - enc->prev);
+    uint16_t z = (uint16_t)(((uint16_t)d << 1) ^ (uint16_t)(d >> 15));
+
+    enc->zz[enc->count - 1U] = z;
+    enc->zz_or |= z;
+    enc->varint_len += (z < 0x80U) ? 1U : (z < 0x4000U) ? 2U : 3U;
+    enc->prev = value;
+    enc->count++;
+}
+
+void LOGC_GetStats(const LOGC_Encoder *enc, LOGC_Stats *stats)
+{
+    *stats = enc->stats;
+}
+
+/* ======== Decoder ======== */
+
+uint8_t LOGC_BlockSpan(const uint8_t *block, uint16_t len, uint32_t *first, uint32_t *last)
+{
+    if ((len < LOGC_HEADER_LEN) || (block[10] == 0U)) return 0;
+
+    *first = get32(&block[0]);
+    *last  = *first + (uint32_t)(block[10] - 1U) * get16(&block[6]);
+    return 1;
+}
+
+uint8_t LOGC_Decode(const uint8_t *block, uint16_t len, LOGC_Sample *out, uint8_t max)
+{
+    if (len < LOGC_HEADER_LEN) return 0;
+
+    uint32_t tick   = get32(&block[0]);
+    uint16_t value  = get16(&block[4]);
+    uint16_t period = get16(&block[6]);
+    uint16_t flags  = get16(&block[8]);
+    uint8_t  count  = block[10];
+    uint8_t  width  = block[11];
+    const uint8_t *p   = &block[LOGC_HEADER_LEN];
+    const uint8_t *end = block + len;
+
+    if ((count == 0U) || (count > LOGC_MAX_SAMPLES) ||
+        ((width > 16U) && (width != LOGC_VARINT))) {
+        return 0;
+    }
+    if ((width != LOGC_VARINT) &&
+        (LOGC_HEADER_LEN + ((count - 1U) * width + 7U) / 8U != len)) {
+        return 0;
+    }
+
+    uint32_t acc = 0;
+    uint8_t  bits = 0;
+    uint16_t mask = (uint16_t)((1UL << (width & 0x1FU)) - 1U);
+
+    for (uint8_t i = 0; i < count; i++) {
+        if (i > 0U) {
+            uint32_t z = 0;
+
+            if (width == LOGC_VARINT) {
+                for (uint8_t shift = 0; ; shift += 7U) {
+                    if ((p == end) || (shift > 14U)) return 0;
+                    z |= (uint32_t)(*p & 0x7FU) << shift;
+                    if ((*p++ & 0x80U) == 0U) break;
+                }
+                if (z > 0xFFFFU) return 0;
+            } else if (width > 0U) {
+                while (bits < width) {
+                    acc |= (uint32_t)*p++ << bits;
+                    bits += 8U;
+                }
+                z = acc & mask;
+                acc >>= width;
+                bits -= width;
+            }
+            value += (uint16_t)((z >> 1) ^ (0U - (z & 1U)));
+            tick  += period;
+        }
+        if (i < max) {
+            out[i].tick  = tick;
+            out[i].value = value;
+            out[i].flags = flags;
+        }
+    }
+
+    if ((width == LOGC_VARINT) && (p != end)) return 0;
+    return (count < max) ? count : max;
+}
@@ -0,0 +1,232 @@
+/*
+ * log_export.c
+ *
+ *  Created on: Oct 17, 2026
+ *      Author: kings
+ */
+
+#include "log_export.h"
+#include "telemetry.h"
+#include "checksum.h"
+#include "usbd_cdc_if.h"
+#include <string.h>
+
+_Static_assert(APP_TX_DATA_SIZE >= 2U * LOGX_CHUNK_LEN,
+               "UserTxBufferFS must hold two chunks");
+
+extern USBD_HandleTypeDef hUsbDeviceFS;
+
+typedef enum {
+    LOGX_IDLE,
+    LOGX_WAIT_USB,      // telemetry paused, its last transfer still out
+    LOGX_RUN,
+} LOGX_State;
+
+#define LOGX_CMD_NONE   0U
+#define LOGX_CMD_DUMP   1U
+#define LOGX_CMD_STOP   2U
+
+static const LOGX_Source *source;
+static LOGX_State state;
+static LOGX_Stats stats;
+
+// OUT IRQ side
+static char    line[8];
+static uint8_t line_len;
+static volatile uint8_t cmd;
+
+/* A chunk is free when its length is 0. The main loop fills free chunks
+ * in turn; the IRQ frees the one on the wire when it completes and starts
+ * the other if it is filled.
+ */
+static uint8_t *chunk[2];
+static volatile uint16_t chunk_len[2];
+static volatile uint8_t  send_idx;
+static volatile uint8_t  in_flight;
+static uint8_t  fill_idx;
+
+// Dump in progress
+static uint32_t total;
+static uint32_t offset;
+static uint32_t crc;
+static uint32_t start_ms;
+static uint8_t  begun;
+static uint8_t  ended;
+
+static uint8_t usb_ready(void)
+{
+    return hUsbDeviceFS.dev_state == USBD_STATE_CONFIGURED;
+}
+
+static void put32(uint8_t *p, uint32_t v)
+{
+    p[0] = v & 0xFF;
+    p[1] = (v >> 8) & 0xFF;
+    p[2] = (v >> 16) & 0xFF;
+    p[3] = v >> 24;
+}
+
+/* IRQ context, or main loop with interrupts masked */
+static void start_chunk(void)
+{
+    uint8_t i = send_idx;
+
+    if (in_flight || (chunk_len[i] == 0)) return;
+
+    if (CDC_Transmit_FS(chunk[i], chunk_len[i]) == USBD_OK) {
+        in_flight = 1;
+        stats.chunks++;
+    }
+}
+
+void LOGX_TxComplete(void)
+{
+    if (!in_flight) return;     // a telemetry transfer
+
+    chunk_len[send_idx] = 0;
+    send_idx ^= 1;
+    in_flight = 0;
+    start_chunk();
+}
+
+void LOGX_Receive(const uint8_t *buf, uint32_t len)
+{
+    for (uint32_t i = 0; i < len; i++) {
+        char c = (char)buf[i];
+
+        if ((c == '\r') || (c == '\n')) {
+            line[line_len] = '\0';
+            if (strcmp(line, "dump") == 0) {
+                cmd = LOGX_CMD_DUMP;
+            } else if (strcmp(line, "stop") == 0) {
+                cmd = LOGX_CMD_STOP;
+            }
+            line_len = 0;
+        } else if (line_len < sizeof(line) - 1U) {
+            line[line_len++] = c;
+        }
+    }
+}
+
+/* ======== Main loop side ======== */
+
+static void finish(void)
+{
+    __disable_irq();
+    chunk_len[0] = chunk_len[1] = 0;
+    in_flight = 0;
+    __enable_irq();
+
+    stats.exports++;
+    stats.last_bytes = offset;
+    stats.last_ms = HAL_GetTick() - start_ms;
+    state = LOGX_IDLE;
+    TLM_Pause(0);
+}
+
+static void begin(void)
+{
+    chunk[0] = UserTxBufferFS;
+    chunk[1] = UserTxBufferFS + LOGX_CHUNK_LEN;
+    chunk_len[0] = chunk_len[1] = 0;
+    send_idx = fill_idx = 0;
+    in_flight = 0;
+
+    total = (source != NULL) ? source->size() : 0U;
+    offset = 0;
+    crc = 0;
+    begun = ended = 0;
+    start_ms = HAL_GetTick();
+
+    TLM_Pause(1);
+    state = LOGX_WAIT_USB;
+}
+
+/* Header frame first, then log bytes, then the end frame once there is
+ * room for it. A short read is padded as erased flash so the length in
+ * the header holds.
+ */
+static void fill_chunk(void)
+{
+    uint8_t *p = chunk[fill_idx];
+    uint32_t n = 0;
+    uint8_t  frame[16];
+
+    if (!begun) {
+        frame[0] = TLM_TYPE_EXPORT;
+        put32(&frame[2], total);
+        n += TLM_EncodeFrame(frame, 6, p);
+        begun = 1;
+    }
+
+    uint32_t want = total - offset;
+    if (want > LOGX_CHUNK_LEN - n) want = LOGX_CHUNK_LEN - n;
+    if (want > 0U) {
+        uint32_t got = (source != NULL) ? source->read(offset, p + n, want) : 0U;
+        if (got < want) memset(p + n + got, 0xFF, want - got);
+        crc = CSUM_Crc32(crc, p + n, want);
+        offset += want;
+        n += want;
+    }
+
+    if ((offset == total) && (LOGX_CHUNK_LEN - n >= 6U + 8U + 2U)) {
+        frame[0] = TLM_TYPE_EXPORT_END;
+        put32(&frame[2], total);
+        put32(&frame[6], crc);
+        n += TLM_EncodeFrame(frame, 10, p + n);
+        ended = 1;
+    }
+
+    chunk_len[fill_idx] = (uint16_t)n;
+    fill_idx ^= 1;
+}
+
+void LOGX_Poll(void)
+{
+    uint8_t c = cmd;
+    cmd = LOGX_CMD_NONE;
+
+    if (state == LOGX_IDLE) {
+        if ((c == LOGX_CMD_DUMP) && usb_ready()) begin();
+        return;
+    }
+
+    // Unplugged, or the host gave up: nothing more of this dump is sent
+    if (!usb_ready() || (c == LOGX_CMD_STOP)) {
+        finish();
+        return;
+    }
+
+    if (state == LOGX_WAIT_USB) {
+        USBD_CDC_HandleTypeDef *hcdc = (USBD_CDC_HandleTypeDef *)hUsbDeviceFS.pClassData;
+        if (hcdc->TxState != 0) return;
+        state = LOGX_RUN;
+    }
+
+    while (!ended && (chunk_len[fill_idx] == 0)) {
+        fill_chunk();
+    }
+
+    __disable_irq();
+    start_chunk();
+    __enable_irq();
+
+    if (ended && !in_flight && (chunk_len[0] == 0) && (chunk_len[1] == 0)) {
+        finish();
+    }
+}
+
+uint8_t LOGX_Busy(void)
+{
+    return state != LOGX_IDLE;
+}
+
+void LOGX_SetSource(const LOGX_Source *src)
+{
+    source = src;
+}
+
+void LOGX_GetStats(LOGX_Stats *s)
+{
+    *s = stats;
+}
@@ -0,0 +1,170 @@
+/*
+ * log_index.c
+ *
+ *  Created on: Oct 17, 2026
+ *      Author: kings
+ */
+
+#include "log_index.h"
+#include <string.h>
+
+typedef struct {
+    uint32_t  time;         // first reading of the block
+    FLOG_Iter pos;          // its entry
+} LIDX_Entry;
+
+static LIDX_Entry entries[LIDX_MAX_ENTRIES];
+static uint32_t   n_entries;
+static uint32_t   stride;
+static uint32_t   since;        // blocks since the stride started over
+static uint32_t   base;
+static uint8_t    block_type;
+static LIDX_Stats stats;
+static LOGC_Sample decoded[LOGC_MAX_SAMPLES];
+
+static uint8_t before(uint32_t a, uint32_t b)
+{
+    return (int32_t)(a - b) < 0;
+}
+
+static uint32_t get32(const uint8_t *p)
+{
+    return p[0] | (p[1] << 8) | (p[2] << 16) | ((uint32_t)p[3] << 24);
+}
+
+/* Entries whose page went round the ring */
+static void drop_stale(void)
+{
+    FLOG_Iter oldest;
+    uint32_t k = 0;
+
+    FLOG_IterInit(&oldest);
+    while ((k < n_entries) && before(entries[k].pos.seq, oldest.seq)) {
+        k++;
+    }
+    if (k > 0U) {
+        n_entries -= k;
+        memmove(entries, &entries[k], n_entries * sizeof(entries[0]));
+    }
+}
+
+static void add(uint32_t time, const FLOG_Iter *pos)
+{
+    stats.blocks++;
+    if (since++ % stride != 0U) return;
+
+    // Out of order means a damaged header; a search past it would go wrong
+    if ((n_entries > 0U) && !before(entries[n_entries - 1U].time, time)) return;
+
+    drop_stale();
+    if (n_entries == LIDX_MAX_ENTRIES) {
+        for (uint32_t i = 1; i < LIDX_MAX_ENTRIES / 2U; i++) {
+            entries[i] = entries[2U * i];
+        }
+        n_entries = LIDX_MAX_ENTRIES / 2U;
+        stride *= 2U;
+    }
+    entries[n_entries].time = time;
+    entries[n_entries].pos  = *pos;
+    n_entries++;
+}
+
+void LIDX_Init(uint8_t type)
+{
+    FLOG_Iter  it, at;
+    FLOG_Entry e;
+    uint32_t   last = 0, first, end;
+    uint8_t    any = 0;
+
+    block_type = type;
+    n_entries = 0;
+    stride = 1;
+    since = 0;
+    stats = (LIDX_Stats){0};
+
+    FLOG_IterInit(&it);
+    while (FLOG_Skim(&it, &e)) {
+        stats.walked++;
+        if (e.len < 4U) continue;
+
+        uint32_t t = get32(e.data);
+        if ((e.type == block_type) && LOGC_BlockSpan(e.data, e.len, &first, &end)) {
+            at.seq = it.seq;
+            at.off = it.off - 8U - ((e.len + 7U) & ~7U);
+            add(first, &at);
+            t = end;
+        }
+        if (!any || before(last, t)) last = t;
+        any = 1;
+    }
+
+    // This session's clock starts after everything already in the log
+    base = any ? last + 1U : 0U;
+}
+
+uint32_t LIDX_Time(uint32_t tick)
+{
+    return base + tick;
+}
+
+void LIDX_AddBlock(const uint8_t *block, uint16_t len)
+{
+    FLOG_Iter at;
+    uint32_t first, last;
+
+    if (!LOGC_BlockSpan(block, len, &first, &last)) return;
+    FLOG_LastAppended(&at);
+    add(first, &at);
+}
+
+void LIDX_Seek(FLOG_Iter *it, uint32_t time)
+{
+    drop_stale();
+    if ((n_entries == 0U) || before(time, entries[0].time)) {
+        FLOG_IterInit(it);
+        return;
+    }
+
+    // Last entry at or before time
+    uint32_t lo = 0, hi = n_entries - 1U;
+    while (lo < hi) {
+        uint32_t mid = (lo + hi + 1U) / 2U;
+        if (before(time, entries[mid].time)) {
+            hi = mid - 1U;
+        } else {
+            lo = mid;
+        }
+    }
+    *it = entries[lo].pos;
+}
+
+uint32_t LIDX_Read(uint32_t from, uint32_t to, LOGC_Sample *out, uint32_t max)
+{
+    FLOG_Iter  it;
+    FLOG_Entry e;
+    uint32_t   count = 0, first, last;
+
+    LIDX_Seek(&it, from);
+    while ((count < max) && FLOG_Next(&it, &e)) {
+        if ((e.type != block_type) || !LOGC_BlockSpan(e.data, e.len, &first, &last)) {
+            continue;
+        }
+        if (before(to, first)) break;       // blocks only get later
+        if (before(last, from)) continue;
+
+        uint8_t m = LOGC_Decode(e.data, e.len, decoded, LOGC_MAX_SAMPLES);
+        for (uint8_t i = 0; (i < m) && (count < max); i++) {
+            if (!before(decoded[i].tick, from) && !before(to, decoded[i].tick)) {
+                out[count++] = decoded[i];
+            }
+        }
+    }
+    return count;
+}
+
+void LIDX_GetStats(LIDX_Stats *s)
+{
+    *s = stats;
+    s->entries = n_entries;
+    s->stride  = stride;
+}
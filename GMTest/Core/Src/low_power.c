@@ -0,0 +1,212 @@
+/*
+ * low_power.c
+ *
+ *  Created on: Oct 17, 2026
+ *      Author: kings
+ */
+
+#include "low_power.h"
+#include "main.h"
+
+/* ======== State ======== */
+
+static uint32_t hz;                     // LPTIM1 count rate
+static uint32_t period_ticks;
+static volatile uint32_t periods;       // ARR matches, counted by the IRQ
+static LPM_ClockRestore restore_clocks;
+static LPM_MeasureHook  hook = NULL;
+
+// Time accounting in LPTIM1 ticks, main loop side
+static uint32_t mark;                   // end of the last stretch counted
+static uint32_t last_sample;
+static uint32_t in_mode[LPM_MODE_COUNT];
+static uint32_t ms_rem;                 // HAL tick catch-up, ms * hz
+
+// Set on a Stop2 wake by LPTIM1, cleared by LPM_Sampled
+static uint8_t  timer_wake;
+static uint32_t wake_ticks;             // wake to clocks back
+static uint32_t restored_cyc;           // DWT when the clocks were back
+
+static uint32_t samples;
+static LPM_Stats stats;
+
+/* ======== Time base ======== */
+
+// The counter runs from the LSI; read until two reads agree
+static uint32_t lptim_cnt(void)
+{
+    uint32_t a, b = LPTIM1->CNT;
+    do {
+        a = b;
+        b = LPTIM1->CNT;
+    } while (a != b);
+    return a;
+}
+
+// Ticks since LPM_Init, wrapping; a match the IRQ has not seen yet counts
+static uint32_t now(void)
+{
+    uint32_t primask = __get_PRIMASK();
+    __disable_irq();
+    uint32_t n = periods;
+    uint32_t c = lptim_cnt();
+    if ((LPTIM1->ISR & LPTIM_ISR_ARRM) && (c < period_ticks / 2U)) {
+        n++;
+    }
+    __set_PRIMASK(primask);
+    return n * period_ticks + c;
+}
+
+static uint32_t to_us(uint32_t ticks)
+{
+    return (uint32_t)((uint64_t)ticks * 1000000U / hz);
+}
+
+/* ======== Public API ======== */
+
+void LPM_Init(uint32_t period_ms, LPM_ClockRestore restore)
+{
+    uint32_t presc = 0;
+
+    restore_clocks = restore;
+    while ((presc < 7U) &&
+           ((uint64_t)period_ms * (LPM_LSI_HZ >> presc) / 1000U > 0x10000U)) {
+        presc++;
+    }
+    hz = LPM_LSI_HZ >> presc;
+    period_ticks = (uint32_t)((uint64_t)period_ms * hz / 1000U);
+    if (period_ticks > 0x10000U) period_ticks = 0x10000U;
+    if (period_ticks < 2U) period_ticks = 2U;
+
+    // LSI as the LPTIM1 kernel clock; both keep running in Stop2
+    SET_BIT(RCC->CSR, RCC_CSR_LSION);
+    while (!READ_BIT(RCC->CSR, RCC_CSR_LSIRDY)) {
+    }
+    MODIFY_REG(RCC->CCIPR, RCC_CCIPR_LPTIM1SEL, RCC_CCIPR_LPTIM1SEL_0);
+    SET_BIT(RCC->APB1ENR1, RCC_APB1ENR1_LPTIM1EN);
+    (void)READ_BIT(RCC->APB1ENR1, RCC_APB1ENR1_LPTIM1EN);
+
+    // CFGR and IER only take writes while disabled, ARR only while enabled
+    LPTIM1->CR   = 0;
+    LPTIM1->CFGR = presc << LPTIM_CFGR_PRESC_Pos;
+    LPTIM1->IER  = LPTIM_IER_ARRMIE;
+    LPTIM1->CR   = LPTIM_CR_ENABLE;
+    LPTIM1->ARR  = period_ticks - 1U;
+    while (!(LPTIM1->ISR & LPTIM_ISR_ARROK)) {
+    }
+    LPTIM1->ICR  = LPTIM_ICR_ARROKCF;
+    LPTIM1->CR  |= LPTIM_CR_CNTSTRT;
+
+    // EXTI line 32 carries the LPTIM1 wakeup out of Stop2
+    SET_BIT(EXTI->IMR2, EXTI_IMR2_IM32);
+    HAL_NVIC_SetPriority(LPTIM1_IRQn, 0, 0);
+    HAL_NVIC_EnableIRQ(LPTIM1_IRQn);
+
+#ifdef DEBUG
+    // Keep the debugger attached through Stop2 (costs current)
+    SET_BIT(DBGMCU->CR, DBGMCU_CR_DBG_STOP);
+#endif
+
+    periods = 0;
+    mark = last_sample = 0;
+    for (uint32_t i = 0; i < LPM_MODE_COUNT; i++) in_mode[i] = 0;
+    ms_rem = 0;
+    timer_wake = 0;
+    samples = 0;
+    stats = (LPM_Stats){0};
+}
+
+void LPM_Idle(uint8_t stop_ok)
+{
+    uint32_t t0 = now();
+    in_mode[LPM_RUN] += t0 - mark;
+
+    if (stop_ok) {
+        HAL_SuspendTick();
+        HAL_PWREx_EnterSTOP2Mode(PWR_STOPENTRY_WFI);
+
+        // On MSI now, interrupts still held off
+        uint32_t t1 = now();
+        in_mode[LPM_STOP2] += t1 - t0;
+        timer_wake = (LPTIM1->ISR & LPTIM_ISR_ARRM) != 0U;
+
+        // SysTick did not count in Stop2
+        uint32_t acc = (t1 - t0) * 1000U + ms_rem;
+        uwTick += acc / hz;
+        ms_rem  = acc % hz;
+        HAL_ResumeTick();
+
+        // The restore counts as run time. It runs with interrupts let in,
+        // so SysTick moves and the HAL_RCC timeouts in it can reach
+        // Error_Handler if a clock fails to start; the wake interrupt is
+        // taken meanwhile, on MSI.
+        uint32_t primask = __get_PRIMASK();
+        __enable_irq();
+        restore_clocks();
+        __set_PRIMASK(primask);
+        mark = t1;
+        if (timer_wake) {
+            wake_ticks   = lptim_cnt();
+            restored_cyc = DWT->CYCCNT;
+        }
+        stats.stops++;
+    } else {
+        HAL_PWR_EnterSLEEPMode(PWR_MAINREGULATOR_ON, PWR_SLEEPENTRY_WFI);
+        mark = now();
+        in_mode[LPM_SLEEP] += mark - t0;
+        stats.sleeps++;
+    }
+}
+
+void LPM_Sampled(void)
+{
+    LPM_Measure m = {0};
+    uint32_t t = now();
+    uint64_t charge = 0;        // nA * ticks
+    static const uint32_t na[LPM_MODE_COUNT] = {
+        LPM_RUN_NA, LPM_SLEEP_NA, LPM_STOP2_NA,
+    };
+
+    in_mode[LPM_RUN] += t - mark;
+    mark = t;
+
+    m.samples   = ++samples;
+    m.period_us = to_us(t - last_sample);
+    for (uint32_t i = 0; i < LPM_MODE_COUNT; i++) {
+        m.mode_us[i] = to_us(in_mode[i]);
+        charge += (uint64_t)na[i] * in_mode[i];
+        in_mode[i] = 0;
+    }
+    if (timer_wake) {
+        m.wake_us    = to_us(wake_ticks);
+        m.latency_us = m.wake_us + (DWT->CYCCNT - restored_cyc) / (SystemCoreClock / 1000000U);
+        timer_wake = 0;
+    }
+    // nJ = nA * us * mV / 1e9
+    m.energy_nj = (uint32_t)(charge * 1000000U / hz * LPM_VDD_MV / 1000000000U);
+    m.avg_na    = (t != last_sample) ? (uint32_t)(charge / (t - last_sample)) : 0U;
+    last_sample = t;
+
+    if (hook != NULL) {
+        hook(&m);
+    }
+}
+
+void LPM_SetMeasureHook(LPM_MeasureHook fn)
+{
+    hook = fn;
+}
+
+void LPM_GetStats(LPM_Stats *s)
+{
+    *s = stats;
+}
+
+void LPM_IRQHandler(void)
+{
+    if (LPTIM1->ISR & LPTIM_ISR_ARRM) {
+        LPTIM1->ICR = LPTIM_ICR_ARRMCF;
+        periods++;
+        stats.wakes++;
+    }
+}
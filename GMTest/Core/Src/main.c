@@ -20,6 +20,7 @@
 /* Includes ------------------------------------------------------------------*/
 #include "main.h"
 #include "adc.h"
+#include "dma.h"
 #include "i2c.h"
 #include "spi.h"
 #include "tim.h"
@@ -30,17 +31,56 @@
 /* Private includes ----------------------------------------------------------*/
 /* USER CODE BEGIN Includes */
 #include "stdio.h"
+#include "stdlib.h"
 #include "lcd_ui.h"
 #include "lcd_driver.h"
+#include "GFX_STM32.h"
+#include "acq.h"
+#include "glucose_cal.h"
+#include "trend.h"
+#include "alarm.h"
+#include "buzzer.h"
+#include "uart_log.h"
+#include "telemetry.h"
+#include "log_export.h"
+#include "flash_log.h"
+#include "log_codec.h"
+#include "log_index.h"
+#include "low_power.h"
+#include "sched.h"
 /* USER CODE END Includes */
 
 /* Private typedef -----------------------------------------------------------*/
 /* USER CODE BEGIN PTD */
-
+// Session log entries (flash_log.h), little endian; each starts with its
+// log time (LIDX_Time), as do LOGC blocks
+typedef struct {
+	uint32_t time;
+	uint32_t reset_flags;   // RCC->CSR reset cause bits at boot
+} LogSession;
+
+typedef struct {
+	uint32_t time;
+	uint8_t  kind;          // Alarm_Kind
+	uint8_t  state;         // Alarm_State
+	uint16_t spare;
+} LogAlarm;
 /* USER CODE END PTD */
 
 /* Private define ------------------------------------------------------------*/
 /* USER CODE BEGIN PD */
+// Set to 1 to print the SPI cost of the glyph-run text path vs per-dot fills
+#define LCD_TEXT_BENCH	0
+#define LOG_SESSION		0x01	// LogSession, once per boot
+#define LOG_READINGS	0x04	// LOGC block of filtered signal readings
+#define LOG_ALARM		0x03	// LogAlarm, on every alarm state change
+// 1: one spot reading per SPOT_PERIOD_MS, Stop2 in between when nothing
+// needs the clocks; 0: continuous sampling at the profile rate, Sleep only
+#define LOW_POWER_SAMPLING	1
+#define SPOT_PERIOD_MS		5000U	// TREND_POINT_MS
+#define LPM_REPORT_EVERY	12U		// samples per power report
+#define LCD_QUEUE_LEN		8U		// readings waiting for the display task
+#define SCHED_REPORT_EVERY	12U		// health runs per scheduler report
 //#define LCD_LENGTH	320
 //#define LCD_HEIGHT	240
 //#define TOP_H		(LCD_HEIGHT / 4)           // 60 pixels
@@ -57,9 +97,62 @@
 /* Private variables ---------------------------------------------------------*/
 
 /* USER CODE BEGIN PV */
-uint16_t  ADCValue;
+ACQ_Block adc_block;
+
+// Sample path filter: 5-point median against spikes, 2nd order CIC
+// decimating by 16 (1 kHz -> 62.5 Hz), then a 0.5 Hz Butterworth low-pass
+// (RBJ cookbook, Q = 0.707, at 62.5 Hz; post shift 1).
+static const q31_t glucose_lp[5] = {
+	654827, 1309653, 654827, 2071185984, -1000063466
+};
+static const FLT_Config glucose_filter_cfg = {
+	.median_len    = 5,
+	.cic_order     = 2,
+	.cic_log2r     = 4,
+	.biquad_stages = 1,
+	.biquad_shift  = 1,
+	.biquad_coefs  = glucose_lp,
+};
+FLT_Chain glucose_filter;
+ACQ_Stats acq_stats;
+uint32_t acq_lost_reported = 0;
 int  glucose;
-volatile int new_data = 0;
+int32_t glucose_q16;
+TREND_Estimate trend;
+Alarm_Input alarm_in;
+
+// Glucose ranges before alerts
+int lower_limit = 70;
+int upper_limit = 150;
+
+// Buzzer patterns per alarm, 100 ms slots: low is 3 + 2 beeps, high 3
+// beeps, both every 3 s; rapid change 2 beeps every 3.2 s
+static const Buzzer_Pattern alarm_low_tone   = { 0x00000295, 30 };
+static const Buzzer_Pattern alarm_high_tone  = { 0x00000015, 30 };
+static const Buzzer_Pattern alarm_rapid_tone = { 0x00000005, 32 };
+static const Buzzer_Pattern *const alarm_tones[ALARM_COUNT + 1] = {
+	[ALARM_LOW]   = &alarm_low_tone,
+	[ALARM_HIGH]  = &alarm_high_tone,
+	[ALARM_RAPID] = &alarm_rapid_tone,
+	[ALARM_NONE]  = NULL,
+};
+ILI9341_QueueStats lcd_stats;
+uint16_t lcd_hwm_reported = 0;
+uint32_t lcd_stalls_reported = 0;
+ULOG_Stats log_stats;
+uint32_t log_dropped_reported = 0;
+FLOG_Stats flog_stats;
+LIDX_Stats lidx_stats;
+uint32_t flog_lost_reported = 0;
+static const LOGX_Source flash_log_source = { FLOG_Size, FLOG_Read };
+LOGC_Encoder reading_log;
+
+// Readings for the graph, from the reading task to the display task
+uint16_t lcd_queue[LCD_QUEUE_LEN];
+uint8_t lcd_queue_head = 0;
+uint8_t lcd_queue_count = 0;
+int8_t task_ids[SCHED_MAX_TASKS];
+uint8_t n_task_ids = 0;
 //uint16_t samples[LCD_LENGTH];
 //uint16_t index = 0;
 /* USER CODE END PV */
@@ -68,7 +161,23 @@ volatile int new_data = 0;
 void SystemClock_Config(void);
 void PeriphCommonClock_Config(void);
 /* USER CODE BEGIN PFP */
-int glucoseCalc(uint16_t ADCValue);
+int32_t glucoseCalc(uint16_t raw16);
+void ACQ_PrintProfile(ACQ_ProfileId id);
+void ACQ_PrintSpot(void);
+void TrendReport(int lower_limit, int upper_limit);
+void AlarmReport(uint8_t changed);
+void LogReadings(const uint8_t *block, uint16_t len);
+uint32_t LogTick(uint32_t tick);
+void RestoreClocks(void);
+void PowerReport(const LPM_Measure *m);
+uint8_t CanStop(void);
+void SpotTask(uint32_t events);
+void ReadingTask(uint32_t events);
+void UsbTask(uint32_t events);
+void DisplayTask(uint32_t events);
+void HealthTask(uint32_t events);
+void SchedReport(void);
+void SchedAdd(const SCHED_Task *task);
 //void graph_update(int glucose);
 //void LCD_Init(void);
 /* USER CODE END PFP */
@@ -87,24 +196,372 @@ int glucoseCalc(uint16_t ADCValue);
 //		tim2_flag = 1;
 //	}
 //}
-void HAL_ADC_ConvCpltCallback(ADC_HandleTypeDef *hadc)
+#if LCD_TEXT_BENCH
+void LCD_TextBenchmark(void)
 {
-	// If interrupt came from ADC1
-    if (hadc->Instance == ADC1) {
+	ILI9341_BusStats bus;
+
+	for (uint8_t runs = 0; runs < 2; runs++) {
+		GFX_SetGlyphRuns(runs);
+		ILI9341_WaitIdle();
+		ILI9341_ResetBusStats();
+		uint32_t start = HAL_GetTick();
+
+		LCD_SetCursor(8, 40);
+		LCD_SetTextSize(4);
+		LCD_SetTextColor(LCD_WHITE);
+		LCD_SetTextBgColor(LCD_DARKGREY);
+		LCD_Print("120");
+		ILI9341_WaitIdle();
+
+		ILI9341_GetBusStats(&bus);
+		printf("Text %s: %lu transfers, %lu bytes, %lu windows, %lu gpio, %lu ms\r\n",
+			   runs ? "glyph runs" : "dot fills", bus.transfers, bus.bytes,
+			   bus.windows, bus.gpio_writes, HAL_GetTick() - start);
+	}
+}
+#endif
 
-    	// Sample ADC
-    	ADCValue = HAL_ADC_GetValue(hadc);
-    	printf("ADC: %d\r\n", ADCValue);
+void ACQ_PrintProfile(ACQ_ProfileId id)
+{
+	const ACQ_Profile *p = ACQ_GetProfileDef(id);
+	ACQ_ProfileInfo info;
+
+	ACQ_GetProfileInfo(id, &info);
+	printf("ADC profile %s: %u Hz, x%u oversampling, %u.%u bits, "
+		   "ADC busy %lu ns (%u.%u %%), CPU %lu.%02lu cycles/sample\r\n",
+		   p->name, p->rate_hz, 1U << p->os_log2,
+		   info.enob_x10 / 10U, info.enob_x10 % 10U, info.conv_ns,
+		   info.adc_duty_x10 / 10U, info.adc_duty_x10 % 10U,
+		   info.cpu_cyc_x100 / 100U, info.cpu_cyc_x100 % 100U);
+}
 
-    	// Set flag to indicate adc value event
-		new_data = 1;
+// What each spot reading actually is: the profile's sample time, x256
+void ACQ_PrintSpot(void)
+{
+	const ACQ_Profile *p = ACQ_GetProfileDef(ACQ_GetProfile());
+	ACQ_ProfileInfo info;
+
+	ACQ_GetSpotInfo(&info);
+	ACQ_GetStats(&acq_stats);
+	printf("ADC spot: every %u ms, %s sample time, x%u oversampling, %u.%u bits, "
+		   "ADC busy %lu ns, CPU %lu cycles/reading, no filter chain\r\n",
+		   SPOT_PERIOD_MS, p->name, 1U << ACQ_SPOT_OS_LOG2,
+		   info.enob_x10 / 10U, info.enob_x10 % 10U, info.conv_ns,
+		   acq_stats.spot_cycles);
+}
 
-    }
+// Sample at 16-bit full scale to mg/dL (Q16) through the active calibration
+int32_t glucoseCalc(uint16_t raw16)
+{
+	return CAL_Convert(raw16);
 }
-int glucoseCalc(uint16_t ADCValue)
+
+// Trend line and, if it reaches a limit soon, when
+void TrendReport(int lower_limit, int upper_limit)
 {
-	// TODO: Placeholder for glucose calculation logic
-	return ADCValue; // Replace with actual calculation
+	uint32_t secs;
+
+	TREND_Get(&trend);
+	if (!trend.valid) {
+		return;
+	}
+
+	int32_t rate = (int32_t)(((int64_t)trend.slope * 10 +
+							  (trend.slope < 0 ? -32768 : 32768)) / 65536);
+	printf("Trend: %c%ld.%ld mg/dL/min\r\n", (rate < 0) ? '-' : '+',
+		   (long)(abs(rate) / 10), (long)(abs(rate) % 10));
+
+	TREND_Limit limit = TREND_Predict(lower_limit << 16, upper_limit << 16,
+									  &secs);
+	if (limit != TREND_LIMIT_NONE) {
+		printf("Alert: %s limit %s %lu min\r\n",
+			   (limit == TREND_LIMIT_LOW) ? "low" : "high",
+			   secs ? "in" : "crossed", (secs + 59U) / 60U);
+	}
+}
+
+// Print and stream the alarms whose state changed in the last Alarm_Update
+void AlarmReport(uint8_t changed)
+{
+	static const char *const state_names[] = {
+		"cleared", "pending", "ACTIVE", "silenced"
+	};
+
+	for (uint8_t k = 0; k < ALARM_COUNT; k++) {
+		if (changed & (1U << k)) {
+			printf("Alarm %s: %s\r\n", Alarm_Name((Alarm_Kind)k),
+				   state_names[Alarm_GetState((Alarm_Kind)k)]);
+			TLM_SendAlarm(HAL_GetTick(), k, Alarm_GetState((Alarm_Kind)k));
+
+			// Readings up to now go in ahead of the alarm
+			LOGC_Flush(&reading_log);
+			LogAlarm entry = {
+				.time  = LIDX_Time(HAL_GetTick()),
+				.kind  = k,
+				.state = Alarm_GetState((Alarm_Kind)k),
+			};
+			FLOG_Append(LOG_ALARM, &entry, sizeof(entry));
+		}
+	}
+}
+
+// LOGC sink: each finished block of readings is one session log entry
+void LogReadings(const uint8_t *block, uint16_t len)
+{
+	if (FLOG_Append(LOG_READINGS, block, len)) {
+		LIDX_AddBlock(block, len);
+	}
+}
+
+// Reading time for the trend and the session log. A spot reading's tick
+// wanders by a millisecond or so around the LPTIM1 cadence (the Stop2
+// catch-up and the SysTick restart); LOGC starts a new block on any reading
+// off it, and with SPOT_PERIOD_MS equal to TREND_POINT_MS one a millisecond
+// early would join the trend point before it. So spot readings are put back
+// on the cadence of the one before. Off by a quarter period or more (a
+// missed wake, a stall) starts it again. Once per reading: it keeps the last.
+uint32_t LogTick(uint32_t tick)
+{
+#if LOW_POWER_SAMPLING
+	static uint32_t last = 0;
+	static uint8_t  have_last = 0;
+
+	if (have_last) {
+		uint32_t n = (tick - last + SPOT_PERIOD_MS / 2U) / SPOT_PERIOD_MS;
+		uint32_t on = last + n * SPOT_PERIOD_MS;
+		int32_t  off = (int32_t)(tick - on);
+
+		if ((n > 0U) && (abs(off) < (int32_t)(SPOT_PERIOD_MS / 4U))) {
+			tick = on;
+		}
+	}
+	last = tick;
+	have_last = 1;
+#endif
+	return tick;
+}
+
+// After Stop2: back from MSI to the PLLs
+void RestoreClocks(void)
+{
+	SystemClock_Config();
+	PeriphCommonClock_Config();
+}
+
+// LPM measure hook: one sample period, every LPM_REPORT_EVERY samples
+void PowerReport(const LPM_Measure *m)
+{
+	if (m->samples % LPM_REPORT_EVERY != 0U) return;
+
+	printf("Power: %lu ms/sample, run %lu us, sleep %lu us, stop2 %lu ms, "
+		   "%lu.%03lu uJ, avg %lu.%lu uA\r\n",
+		   m->period_us / 1000U, m->mode_us[LPM_RUN], m->mode_us[LPM_SLEEP],
+		   m->mode_us[LPM_STOP2] / 1000U, m->energy_nj / 1000U, m->energy_nj % 1000U,
+		   m->avg_na / 1000U, m->avg_na % 1000U / 100U);
+	if (m->wake_us != 0U) {
+		printf("Power: wake to clocks %lu us, to sample %lu us\r\n",
+			   m->wake_us, m->latency_us);
+	}
+
+	// Since boot: how often the idle policy chose each mode
+	LPM_Stats lpm_stats;
+	LPM_GetStats(&lpm_stats);
+	printf("Power: %lu Stop2, %lu Sleep, %lu LPTIM1 wakes\r\n",
+		   lpm_stats.stops, lpm_stats.sleeps, lpm_stats.wakes);
+}
+
+// Stop2 stops every clock but the LSI: nothing may be moving or sounding,
+// and USB must be able to enumerate from the moment the plug goes in
+uint8_t CanStop(void)
+{
+	return !FLOG_Busy() && !ULOG_Busy() && !LCD_IsBusy() && !LOGX_Busy() &&
+		   !TLM_Connected() && !TLM_VbusPresent() &&
+		   (Alarm_Sounding() == ALARM_NONE);
+}
+
+// Main loop tasks (sched.h), highest priority first. Each runs to
+// completion, so none may wait on hardware for long; the display redraw
+// is the longest and runs last.
+
+// LPTIM1 period: one spot reading
+void SpotTask(uint32_t events)
+{
+	if (ACQ_Spot()) {
+		SCHED_Signal(EVT_ADC_BLOCK);
+	}
+}
+
+// Blocks waiting in the ring: glucose, trend, alarms, telemetry and log.
+// The display only gets a queued sample, drawn by DisplayTask.
+void ReadingTask(uint32_t events)
+{
+	// One block per ACQ_BLOCK_MS of samples, or per spot reading
+	while (ACQ_GetBlock(&adc_block)) {
+		uint32_t tick = LogTick(adc_block.tick);
+
+		LPM_Sampled();
+
+		// Calculate glucose from the filtered signal
+		glucose_q16 = glucoseCalc(adc_block.filt16);
+		glucose = (glucose_q16 + 0x8000) >> 16;
+		printf("ADC: %u (%u..%u) filtered %u, Glucose: %d mg/dL\r\n",
+			   adc_block.mean, adc_block.min, adc_block.max,
+			   adc_block.filt16 >> 4, glucose);
+
+		// Profile report once the CPU cost has been measured
+		if (adc_block.seq == 0) {
+			CAL_Stats cal_stats;
+
+			CAL_GetStats(&cal_stats);
+#if LOW_POWER_SAMPLING
+			ACQ_PrintSpot();
+			printf("Calibration: %lu cycles/conversion\r\n", cal_stats.last_cycles);
+#else
+			FLT_Stats flt_stats;
+
+			ACQ_PrintProfile(ACQ_GetProfile());
+			FLT_ChainGetStats(&glucose_filter, &flt_stats);
+			printf("Filter: %lu.%02lu cycles/sample, calibration: %lu cycles/conversion\r\n",
+				   flt_stats.cyc_x100 / 100U, flt_stats.cyc_x100 % 100U,
+				   cal_stats.last_cycles);
+#endif
+		}
+
+		// Graph point for the display task; the oldest goes if it is behind
+		if (lcd_queue_count == LCD_QUEUE_LEN) {
+			lcd_queue_head = (lcd_queue_head + 1U) % LCD_QUEUE_LEN;
+			lcd_queue_count--;
+		}
+		lcd_queue[(lcd_queue_head + lcd_queue_count) % LCD_QUEUE_LEN] = adc_block.filt16 >> 4;
+		lcd_queue_count++;
+
+		// Rate of change, updated once per TREND_POINT_MS
+		if (TREND_AddSample(tick, glucose_q16)) {
+			TrendReport(lower_limit, upper_limit);
+		}
+
+		// Alarms on every reading; the buzzer plays the most severe one
+		TREND_Get(&trend);
+		alarm_in.value       = glucose_q16;
+		alarm_in.slope       = trend.slope;
+		alarm_in.slope_valid = trend.valid;
+		alarm_in.predicted   = TREND_Predict(lower_limit << 16,
+											 upper_limit << 16,
+											 &alarm_in.predict_s);
+
+		// Reading out over USB first, then any alarm changes
+		TLM_SendGlucose(adc_block.tick, glucose_q16, adc_block.filt16,
+						trend.slope, trend.valid, adc_block.flags);
+		AlarmReport(Alarm_Update(HAL_GetTick(), &alarm_in));
+
+		// Reading into the session log, a delta-coded block a minute;
+		// programming runs from the flash IRQ
+		LOGC_Add(&reading_log, LIDX_Time(tick), adc_block.filt16,
+				 adc_block.flags);
+		Buzzer_Play(alarm_tones[Alarm_Sounding()]);
+	}
+
+	SCHED_Signal(EVT_USB | EVT_DISPLAY);
+}
+
+// Hand queued telemetry to USB as soon as the last transfer is done;
+// a "dump" command from the host pauses it while the log goes out
+void UsbTask(uint32_t events)
+{
+	LOGX_Poll();
+	TLM_Poll();
+}
+
+// New readings: value and graph
+void DisplayTask(uint32_t events)
+{
+	if (lcd_queue_count == 0U) {
+		return;
+	}
+
+	LCD_UI_UpdateCurrentValue(glucose);
+	while (lcd_queue_count > 0U) {
+		LCD_UI_AddSample(lcd_queue[lcd_queue_head]);
+		lcd_queue_head = (lcd_queue_head + 1U) % LCD_QUEUE_LEN;
+		lcd_queue_count--;
+	}
+	LCD_UI_Flush();
+	//graph_update(glucose);
+}
+
+// Every 5 s: anything lost since the last run, and now and then how the
+// tasks are doing
+void HealthTask(uint32_t events)
+{
+	static uint32_t runs = 0;
+
+	// Report lost blocks (loop too slow) or ADC overruns
+	ACQ_GetStats(&acq_stats);
+	if (acq_stats.dropped + acq_stats.overruns > acq_lost_reported) {
+		printf("ADC: %lu samples dropped, %lu overruns\r\n",
+			   acq_stats.dropped, acq_stats.overruns);
+		acq_lost_reported = acq_stats.dropped + acq_stats.overruns;
+	}
+
+	// Report display queue overload (high-water mark or stalls grew)
+	LCD_GetQueueStats(&lcd_stats);
+	if (lcd_stats.high_water > lcd_hwm_reported ||
+		lcd_stats.stalls > lcd_stalls_reported) {
+		printf("LCD queue: hwm %u/%u, stalls %lu\r\n",
+			   lcd_stats.high_water, ILI9341_QUEUE_LEN, lcd_stats.stalls);
+		lcd_hwm_reported = lcd_stats.high_water;
+		lcd_stalls_reported = lcd_stats.stalls;
+	}
+
+	// Report log output lost to a full ring
+	ULOG_GetStats(&log_stats);
+	if (log_stats.dropped > log_dropped_reported) {
+		printf("Log: %lu bytes dropped, hwm %lu/%u\r\n",
+			   log_stats.dropped, log_stats.high_water, ULOG_BUF_LEN);
+		log_dropped_reported = log_stats.dropped;
+	}
+
+	// Report session log entries refused or flash operations failed
+	FLOG_GetStats(&flog_stats);
+	if (flog_stats.dropped + flog_stats.errors > flog_lost_reported) {
+		printf("Flash log: %lu entries dropped, %lu errors\r\n",
+			   flog_stats.dropped, flog_stats.errors);
+		flog_lost_reported = flog_stats.dropped + flog_stats.errors;
+	}
+
+	if (++runs % SCHED_REPORT_EVERY == 0U) {
+		SchedReport();
+	}
+}
+
+// Per task: runs, longest execution, worst latency and response since boot
+void SchedReport(void)
+{
+	for (uint8_t i = 0; i < n_task_ids; i++) {
+		const SCHED_Task *t = SCHED_GetTask(task_ids[i]);
+		SCHED_Stats st;
+
+		SCHED_GetStats(task_ids[i], &st);
+		printf("Task %s: %lu runs, wcet %lu cycles (%lu us), latency %lu ms, "
+			   "response %lu ms, %lu missed, %lu skipped\r\n",
+			   t->name, st.runs, st.wcet_cycles,
+			   st.wcet_cycles / (SystemCoreClock / 1000000U), st.max_latency_ms,
+			   st.max_response_ms, st.misses, st.skipped);
+	}
+}
+
+// Priority, release and deadline per task; periods are only as fine as the
+// wakes, in Stop2 the LPTIM1 period
+static const SCHED_Task spot_task    = { "spot",    SpotTask,    0, EVT_SPOT_DUE,  0,    ACQ_SPOT_TIMEOUT_MS };
+static const SCHED_Task reading_task = { "reading", ReadingTask, 1, EVT_ADC_BLOCK, 0,    100 };
+static const SCHED_Task usb_task     = { "usb",     UsbTask,     2, EVT_USB,       0,    50 };
+static const SCHED_Task display_task = { "display", DisplayTask, 3, EVT_DISPLAY,   0,    1000 };
+static const SCHED_Task health_task  = { "health",  HealthTask,  4, 0,             5000, 0 };
+
+void SchedAdd(const SCHED_Task *task)
+{
+	task_ids[n_task_ids++] = SCHED_Add(task);
 }
 /* USER CODE END 0 */
 
@@ -141,6 +598,8 @@ int main(void)
 
   /* Initialize all configured peripherals */
   MX_GPIO_Init();
+  MX_DMA_Init();
+  MX_TIM1_Init();
   MX_TIM2_Init();
   MX_ADC1_Init();
   MX_I2C1_Init();
@@ -160,60 +619,108 @@ int main(void)
    * USB - USB-C Port
    */
 
+  // printf output drains over UART4 TX DMA from here on
+  ULOG_Init();
+
+  // Session log in flash bank 2; "dump" over USB CDC exports it
+  FLOG_Init();
+  LIDX_Init(LOG_READINGS);
+  LogSession session = {
+	  .time        = LIDX_Time(HAL_GetTick()),
+	  .reset_flags = RCC->CSR,
+  };
+  FLOG_Append(LOG_SESSION, &session, sizeof(session));
+  LOGC_Init(&reading_log, LogReadings);
+  SET_BIT(RCC->CSR, RCC_CSR_RMVF);
+  LOGX_SetSource(&flash_log_source);
+
   // Init screen, alarm, user inputs
   LCD_Init();
   LCD_FillScreen(LCD_BLACK);
   LCD_FillRect(10, 10, 100, 50, LCD_RED);
+#if LCD_TEXT_BENCH
+  LCD_TextBenchmark();   // before LCD_UI_Init so text goes to the panel
+#endif
 
   LCD_UI_Init();
   LCD_UI_SetLabel("Glucose (mg/dL)"); // or "ADC Value"
-  //Alarm_Init();
-
-  // Glucose ranges before alerts
-  int lower_limit = 70;
-  int upper_limit = 150;
+  // One graph sample per reading, so the trend windows match their labels
+  LCD_UI_SetSamplePeriod(LOW_POWER_SAMPLING ? SPOT_PERIOD_MS : ACQ_BLOCK_MS);
+
+  Alarm_Config alarm_cfg = {
+	  .lower       = lower_limit << 16,
+	  .upper       = upper_limit << 16,
+	  .level_hyst  = 5 << 16,         // 5 mg/dL back inside to clear
+	  .rate_limit  = 2 << 16,         // 2 mg/dL/min
+	  .rate_hyst   = 1 << 15,
+	  .predict_s   = 15 * 60,         // warn 15 min ahead of a crossing
+	  .on_delay_ms = 15000,
+	  .min_on_ms   = 60000,
+	  .silence_ms  = 15 * 60000,
+  };
+  Alarm_Init(&alarm_cfg);
+  Buzzer_Init();
 
   //printf("\r\n=== STM32L475RGT6 UART Test ===\r\n");
   printf("\r\n=== KINGSLEY IS THE GOAT ===\r\n");
   printf("SYSCLK: %lu Hz, PCLK1: %lu Hz\r\n",
          HAL_RCC_GetSysClockFreq(), HAL_RCC_GetPCLK1Freq());
-
-  // Testing functions by setting and resetting pin for Buzzer
-  //HAL_GPIO_WritePin(GPIOA, GPIO_PIN_10, GPIO_PIN_SET);
-  //HAL_GPIO_WritePin(GPIOA, GPIO_PIN_10, GPIO_PIN_RESET);
-  //HAL_GPIO_TogglePin(GPIOA, GPIO_PIN_10); // typically fast; but avoid if HAL_GPIO uses locking
-
-  // Enable interrupts
-  HAL_TIM_Base_Start_IT(&htim2);
-  HAL_ADC_Start_IT(&hadc1);
+  FLOG_GetStats(&flog_stats);
+  LIDX_GetStats(&lidx_stats);
+  printf("Flash log: %lu pages, %lu reading blocks, index %lu x %lu%s\r\n",
+         flog_stats.pages, lidx_stats.blocks, lidx_stats.entries, lidx_stats.stride,
+         flog_stats.recovered ? ", torn page closed" : "");
+
+  // Start TIM2-triggered ADC1 sampling into the circular DMA buffer
+  CAL_Init();
+  TREND_Init();
+  FLT_ChainInit(&glucose_filter, &glucose_filter_cfg);
+  ACQ_SetFilter(&glucose_filter);
+  TLM_Init();
+  ACQ_SetSampleSink(TLM_AddSample);   // raw samples out over USB CDC
+  ACQ_SetProfile(ACQ_PROFILE_BALANCED);
+
+  // Main loop tasks, released from here on
+  SCHED_Init();
+#if LOW_POWER_SAMPLING
+  SchedAdd(&spot_task);
+#endif
+  SchedAdd(&reading_task);
+  SchedAdd(&usb_task);
+  SchedAdd(&display_task);
+  SchedAdd(&health_task);
+
+  // Idle policy; LPTIM1 is also the spot sampling clock
+  LPM_Init(SPOT_PERIOD_MS, RestoreClocks);
+  LPM_SetMeasureHook(PowerReport);
+#if LOW_POWER_SAMPLING
+  printf("Sampling: spot every %u ms, Stop2 in between\r\n", SPOT_PERIOD_MS);
+  ACQ_StartSpot();
+#else
+  ACQ_Start();
+#endif
 
   /* USER CODE END 2 */
 
   /* Infinite loop */
   /* USER CODE BEGIN WHILE */
   while (1) {
-	  // TODO - Implement graph functionality, dummy glucose data below
-	  if (new_data) {
-		  // Calculate glucose from ADC value
-		  glucose = glucoseCalc(ADCValue);
-		  printf("Glucose: %d mg/dL\r\n", glucose);
-
-		  LCD_UI_UpdateCurrentValue(ADCValue);
-		  LCD_UI_AddSample(ADCValue);
-		  //graph_update(glucose);
-		  new_data = 0;
+	  // The released task that comes first, one per pass
+	  if (SCHED_RunOne()) {
+		  continue;
 	  }
+
+	  // Nothing released: Sleep, or Stop2 when allowed, until an interrupt.
+	  // Checked with interrupts off so a signal from now on wakes the core.
+	  __disable_irq();
+	  if (!SCHED_Pending()) {
+		  LPM_Idle(LOW_POWER_SAMPLING && CanStop());
+	  }
+	  __enable_irq();
 	  /*
 	   * Update graph on touchscreen LCD
 	   * InsertMethodHere();
 	   *
-	   * Update_trend(ADCValue);
-	   * if (glucose < lower_limit || glucose > upper_limit)
-	   *   {
-	   *     Alarm_On();
-	   *   }
-	   *
-	   *   LogData(glucose);
 	   *   ADR_Ready_Flag = 0;
 	   */
 
@@ -301,9 +808,10 @@ void PeriphCommonClock_Config(void)
 }
 
 /* USER CODE BEGIN 4 */
+// printf backend: queue for UART4 DMA, never wait for the UART
 int _write(int file, char *ptr, int len)
 {
-    HAL_UART_Transmit(&huart4, (uint8_t*)ptr, len, HAL_MAX_DELAY);
+    ULOG_Write(ptr, (uint32_t)len);
     return len;
 }
 /* USER CODE END 4 */
@@ -316,6 +824,11 @@ void Error_Handler(void)
 {
   /* USER CODE BEGIN Error_Handler_Debug */
   /* User can add his own implementation to report the HAL error return state */
+  // Get the log out first; without interrupts the tick stands still
+  printf("Error_Handler: halted\r\n");
+  if (__get_PRIMASK() == 0U) {
+    ULOG_Flush(100);
+  }
   __disable_irq();
   while (1)
   {
@@ -0,0 +1,93 @@
+/*
+ * sample_ring.c
+ *
+ *  Created on: Oct 17, 2026
+ *      Author: kings
+ */
+
+#include "sample_ring.h"
+#include "main.h"       // CMSIS __DMB
+
+void SRING_Init(SRING_Ring *r, SRING_Sample *buf, uint32_t len)
+{
+    r->buf  = buf;
+    r->mask = len - 1U;
+    r->head = 0;
+    r->tail = 0;
+    r->pending_flags = SRING_FLAG_GAP;  // nothing came before the first one
+    r->stats = (SRING_Stats){0};
+}
+
+/* ======== Producer ======== */
+
+uint8_t SRING_Push(SRING_Ring *r, uint32_t tick, uint16_t raw, uint16_t flags)
+{
+    uint32_t head  = r->head;
+    uint32_t count = head - r->tail;
+
+    if (count > r->mask) {
+        r->stats.dropped++;
+        r->pending_flags |= SRING_FLAG_GAP;
+        return 0;
+    }
+
+    SRING_Sample *s = &r->buf[head & r->mask];
+    s->tick  = tick;
+    s->raw   = raw;
+    s->flags = flags | r->pending_flags;
+    r->pending_flags = 0;
+
+    __DMB();            // sample visible before the new head
+    r->head = head + 1U;
+
+    r->stats.pushed++;
+    if (count + 1U > r->stats.high_water) {
+        r->stats.high_water = count + 1U;
+    }
+    return 1;
+}
+
+void SRING_MarkNext(SRING_Ring *r, uint16_t flags)
+{
+    r->pending_flags |= flags;
+}
+
+/* ======== Consumer ======== */
+
+uint8_t SRING_Pop(SRING_Ring *r, SRING_Sample *s)
+{
+    uint32_t tail = r->tail;
+    if (tail == r->head) return 0;
+
+    __DMB();            // read the slot only after seeing the new head
+    *s = r->buf[tail & r->mask];
+    __DMB();            // finish reading before the slot is handed back
+    r->tail = tail + 1U;
+    return 1;
+}
+
+uint32_t SRING_Read(SRING_Ring *r, SRING_Sample *out, uint32_t max)
+{
+    uint32_t tail  = r->tail;
+    uint32_t count = r->head - tail;
+    if (count > max) count = max;
+    if (count == 0U) return 0;
+
+    __DMB();
+    for (uint32_t i = 0; i < count; i++) {
+        out[i] = r->buf[(tail + i) & r->mask];
+    }
+    __DMB();
+    r->tail = tail + count;
+    return count;
+}
+
+uint32_t SRING_Count(const SRING_Ring *r)
+{
+    return r->head - r->tail;
+}
+
+void SRING_GetStats(const SRING_Ring *r, SRING_Stats *stats)
+{
+    *stats = r->stats;
+}
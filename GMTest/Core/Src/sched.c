@@ -0,0 +1,191 @@
+/*
+ * sched.c
+ *
+ *  Created on: Oct 17, 2026
+ *      Author: kings
+ */
+
+#include "sched.h"
+#include "stm32l4xx_hal.h"
+
+typedef struct {
+    const SCHED_Task *def;
+    uint32_t    next;           // next periodic release
+    uint32_t    release;        // of the run waiting, ms
+    uint32_t    events;         // bits it will be passed
+    uint8_t     ready;
+    SCHED_Stats stats;
+} SCHED_Slot;
+
+static SCHED_Slot tasks[SCHED_MAX_TASKS];
+static uint32_t   n_tasks;
+static volatile uint32_t pending;   // signalled, not handed to tasks yet
+static volatile uint32_t since[32]; // when each pending bit was signalled
+
+static uint8_t reached(uint32_t now, uint32_t t)
+{
+    return (int32_t)(now - t) >= 0;
+}
+
+/* Hands out the signalled bits and the periods that came round */
+static void release(uint32_t now)
+{
+    uint32_t at[32];
+
+    __disable_irq();
+    uint32_t ev = pending;
+    pending = 0;
+    for (uint32_t b = ev; b != 0U; b &= b - 1U) {
+        at[__builtin_ctz(b)] = since[__builtin_ctz(b)];
+    }
+    __enable_irq();
+
+    for (uint32_t i = 0; i < n_tasks; i++) {
+        SCHED_Slot *s = &tasks[i];
+        const SCHED_Task *d = s->def;
+        uint32_t got = ev & d->events;
+
+        if (got != 0U) {
+            // Released by the first of its bits to be signalled
+            uint32_t t = now;
+            for (uint32_t b = got; b != 0U; b &= b - 1U) {
+                if (!reached(at[__builtin_ctz(b)], t)) t = at[__builtin_ctz(b)];
+            }
+            if (!s->ready) {
+                s->ready   = 1;
+                s->release = t;
+            }
+            s->events |= got;
+        }
+        if ((d->period_ms > 0U) && reached(now, s->next)) {
+            // Periods since, the newest one is the release
+            uint32_t n = (now - s->next) / d->period_ms;
+            uint32_t t = s->next + n * d->period_ms;
+
+            s->stats.skipped += n;
+            if (!s->ready) {
+                s->ready   = 1;
+                s->release = t;
+            } else {
+                s->stats.skipped++;
+            }
+            s->next = t + d->period_ms;
+        }
+    }
+}
+
+/* Highest priority, then earliest deadline, then table order */
+static SCHED_Slot *pick(void)
+{
+    SCHED_Slot *best = NULL;
+    uint32_t best_due = 0;
+
+    for (uint32_t i = 0; i < n_tasks; i++) {
+        SCHED_Slot *s = &tasks[i];
+        if (!s->ready) continue;
+
+        const SCHED_Task *d = s->def;
+        uint32_t due = s->release + d->deadline_ms;
+        if ((best == NULL) || (d->priority < best->def->priority)) {
+            best = s;
+            best_due = due;
+        } else if ((d->priority == best->def->priority) && (d->deadline_ms > 0U) &&
+                   ((best->def->deadline_ms == 0U) || !reached(due, best_due))) {
+            best = s;
+            best_due = due;
+        }
+    }
+    return best;
+}
+
+void SCHED_Init(void)
+{
+    n_tasks = 0;
+    pending = 0;
+
+    // Cycle counter for the execution times
+    CoreDebug->DEMCR |= CoreDebug_DEMCR_TRCENA_Msk;
+    DWT->CTRL |= DWT_CTRL_CYCCNTENA_Msk;
+}
+
+int8_t SCHED_Add(const SCHED_Task *task)
+{
+    if (n_tasks == SCHED_MAX_TASKS) return -1;
+
+    SCHED_Slot *s = &tasks[n_tasks];
+    *s = (SCHED_Slot){0};
+    s->def  = task;
+    s->next = HAL_GetTick() + task->period_ms;
+    return (int8_t)n_tasks++;
+}
+
+void SCHED_Signal(uint32_t events)
+{
+    uint32_t primask = __get_PRIMASK();
+    __disable_irq();
+    uint32_t now = HAL_GetTick();
+    for (uint32_t b = events & ~pending; b != 0U; b &= b - 1U) {
+        since[__builtin_ctz(b)] = now;
+    }
+    pending |= events;
+    __set_PRIMASK(primask);
+}
+
+uint8_t SCHED_RunOne(void)
+{
+    release(HAL_GetTick());
+
+    SCHED_Slot *s = pick();
+    if (s == NULL) return 0;
+
+    const SCHED_Task *d = s->def;
+    uint32_t ev = s->events;
+    s->events = 0;
+    s->ready  = 0;
+
+    uint32_t start = HAL_GetTick();
+    uint32_t cyc   = DWT->CYCCNT;
+    d->fn(ev);
+    cyc = DWT->CYCCNT - cyc;
+    uint32_t end = HAL_GetTick();
+
+    SCHED_Stats *st = &s->stats;
+    st->runs++;
+    st->last_cycles = cyc;
+    if (cyc > st->wcet_cycles) st->wcet_cycles = cyc;
+    if (start - s->release > st->max_latency_ms) st->max_latency_ms = start - s->release;
+    if (end - s->release > st->max_response_ms) st->max_response_ms = end - s->release;
+    if ((d->deadline_ms > 0U) && (end - s->release > d->deadline_ms)) {
+        st->misses++;
+    }
+    return 1;
+}
+
+uint8_t SCHED_Pending(void)
+{
+    uint32_t now = HAL_GetTick();
+    uint32_t ev  = pending;
+
+    for (uint32_t i = 0; i < n_tasks; i++) {
+        const SCHED_Slot *s = &tasks[i];
+        if (s->ready || (ev & s->def->events) ||
+            ((s->def->period_ms > 0U) && reached(now, s->next))) {
+            return 1;
+        }
+    }
+    return 0;
+}
+
+const SCHED_Task *SCHED_GetTask(int8_t id)
+{
+    return ((id >= 0) && ((uint32_t)id < n_tasks)) ? tasks[id].def : NULL;
+}
+
+void SCHED_GetStats(int8_t id, SCHED_Stats *stats)
+{
+    if ((id >= 0) && ((uint32_t)id < n_tasks)) {
+        *stats = tasks[id].stats;
+    } else {
+        *stats = (SCHED_Stats){0};
+    }
+}
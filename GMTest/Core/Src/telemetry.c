@@ -0,0 +1,223 @@
+/*
+ * telemetry.c
+ *
+ *  Created on: Oct 17, 2026
+ *      Author: kings
+ */
+
+#include "telemetry.h"
+#include "checksum.h"
+#include "usbd_cdc_if.h"
+
+#define TLM_HALF_LEN    (APP_TX_DATA_SIZE / 2U)
+
+_Static_assert(TLM_MAX_PAYLOAD + 4U <= 254U, "frame must be one COBS block");
+_Static_assert(TLM_HALF_LEN >= TLM_MAX_PAYLOAD + 6U, "half must hold a frame");
+
+extern USBD_HandleTypeDef hUsbDeviceFS;
+
+static uint8_t  *half[2];
+static uint16_t  half_len[2];
+static uint8_t   fill;          // half being filled; the other may be in flight
+static uint8_t   seq;
+static uint8_t   paused;
+static TLM_Stats stats;
+
+// Sample batch being built
+static uint8_t   batch[TLM_MAX_PAYLOAD + 4];
+static uint8_t   batch_count;
+static uint8_t   batch_flags;
+static uint32_t  batch_tick0;
+static uint32_t  batch_tick1;
+
+static void put16(uint8_t *p, uint16_t v)
+{
+    p[0] = v & 0xFF;
+    p[1] = v >> 8;
+}
+
+static void put32(uint8_t *p, uint32_t v)
+{
+    put16(p, v & 0xFFFF);
+    put16(p + 2, v >> 16);
+}
+
+/* ======== Framing ======== */
+
+/* COBS for one block of at most 254 bytes: out gets len + 1 bytes */
+static uint32_t cobs_encode(const uint8_t *in, uint32_t len, uint8_t *out)
+{
+    uint8_t *code = out++;
+    uint8_t  run  = 1;
+
+    for (uint32_t i = 0; i < len; i++) {
+        if (in[i] == 0) {
+            *code = run;
+            code  = out++;
+            run   = 1;
+        } else {
+            *out++ = in[i];
+            run++;
+        }
+    }
+    *code = run;
+    return len + 1U;
+}
+
+static uint8_t usb_ready(void)
+{
+    return hUsbDeviceFS.dev_state == USBD_STATE_CONFIGURED;
+}
+
+uint32_t TLM_EncodeFrame(uint8_t *payload, uint32_t len, uint8_t *out)
+{
+    payload[1] = seq++;
+    put32(&payload[len], CSUM_Crc32(0, payload, len));
+
+    uint32_t n = cobs_encode(payload, len + 4U, out);
+    out[n++] = 0;
+    return n;
+}
+
+/* Appends one frame to the filling half. The payload buffer needs 4 spare
+ * bytes past len for the CRC.
+ */
+static void send_frame(uint8_t *payload, uint32_t len)
+{
+    if (usb_ready() && (half_len[fill] + len + 6U > TLM_HALF_LEN)) {
+        TLM_Poll();
+    }
+    if (paused || !usb_ready() || (half_len[fill] + len + 6U > TLM_HALF_LEN)) {
+        seq++;
+        stats.dropped++;
+        return;
+    }
+
+    uint32_t n = TLM_EncodeFrame(payload, len, &half[fill][half_len[fill]]);
+    half_len[fill] += n;
+    stats.frames++;
+    stats.bytes += n;
+}
+
+static void flush_batch(void)
+{
+    if (batch_count == 0) return;
+
+    batch[0] = TLM_TYPE_SAMPLES;
+    batch[2] = batch_count;
+    batch[3] = batch_flags;
+    put32(&batch[4], batch_tick0);
+    put16(&batch[8], (uint16_t)(batch_tick1 - batch_tick0));
+
+    send_frame(batch, 10U + 2U * batch_count);
+
+    batch_count = 0;
+    batch_flags = 0;
+}
+
+/* ======== API ======== */
+
+void TLM_Init(void)
+{
+    GPIO_InitTypeDef gpio = {0};
+
+    // VBUS sense, both edges; EXTI9_5_IRQHandler clears them
+    __HAL_RCC_GPIOA_CLK_ENABLE();
+    gpio.Pin  = TLM_VBUS_Pin;
+    gpio.Mode = GPIO_MODE_IT_RISING_FALLING;
+    gpio.Pull = GPIO_PULLDOWN;
+    HAL_GPIO_Init(TLM_VBUS_GPIO_Port, &gpio);
+    HAL_NVIC_SetPriority(EXTI9_5_IRQn, 0, 0);
+    HAL_NVIC_EnableIRQ(EXTI9_5_IRQn);
+
+    half[0] = UserTxBufferFS;
+    half[1] = UserTxBufferFS + TLM_HALF_LEN;
+    half_len[0] = half_len[1] = 0;
+    fill = 0;
+    seq = 0;
+    batch_count = 0;
+    batch_flags = 0;
+    stats = (TLM_Stats){0};
+}
+
+void TLM_AddSample(const SRING_Sample *s)
+{
+    if ((s->flags & SRING_FLAG_GAP) || (batch_count == TLM_BATCH_MAX)) {
+        flush_batch();
+    }
+
+    if (batch_count == 0) {
+        batch_tick0 = s->tick;
+    }
+    batch_tick1 = s->tick;
+    batch_flags |= (uint8_t)s->flags;
+    put16(&batch[10 + 2 * batch_count], s->raw);
+    batch_count++;
+}
+
+void TLM_SendGlucose(uint32_t tick, int32_t glucose, uint16_t filt16,
+                     int32_t slope, uint8_t slope_valid, uint16_t flags)
+{
+    uint8_t p[19 + 4];
+
+    p[0] = TLM_TYPE_GLUCOSE;
+    put32(&p[2], tick);
+    put32(&p[6], (uint32_t)glucose);
+    put16(&p[10], filt16);
+    put32(&p[12], (uint32_t)slope);
+    p[16] = slope_valid;
+    put16(&p[17], flags);
+    send_frame(p, 19);
+}
+
+void TLM_SendAlarm(uint32_t tick, uint8_t kind, uint8_t state)
+{
+    uint8_t p[8 + 4];
+
+    p[0] = TLM_TYPE_ALARM;
+    put32(&p[2], tick);
+    p[6] = kind;
+    p[7] = state;
+    send_frame(p, 8);
+}
+
+/* CDC_Transmit_FS refuses while the class still has a transfer out, so a
+ * successful call means the other half is free to fill. Unplugging loses
+ * whatever was queued.
+ */
+void TLM_Poll(void)
+{
+    if (paused) return;
+    if (!usb_ready()) {
+        half_len[0] = half_len[1] = 0;
+        return;
+    }
+    if (half_len[fill] == 0) return;
+
+    if (CDC_Transmit_FS(half[fill], half_len[fill]) == USBD_OK) {
+        stats.transfers++;
+        fill ^= 1;
+        half_len[fill] = 0;
+    }
+}
+
+void TLM_Pause(uint8_t on)
+{
+    paused = on;
+    half_len[0] = half_len[1] = 0;
+}
+
+void TLM_GetStats(TLM_Stats *s)
+{
+    *s = stats;
+}
+
+uint8_t TLM_Connected(void)
+{
+    return usb_ready();
+}
+
+uint8_t TLM_VbusPresent(void)
+{
+    return HAL_GPIO_ReadPin(TLM_VBUS_GPIO_Port, TLM_VBUS_Pin) == GPIO_PIN_SET;
+}
@@ -0,0 +1,139 @@
+/*
+ * trend.c
+ *
+ *  Created on: Oct 17, 2026
+ *      Author: kings
+ */
+
+#include "trend.h"
+
+/* ======== State ======== */
+
+// Point being accumulated
+static uint32_t acc_start;
+static int64_t  acc_sum;
+static uint16_t acc_count;
+
+// Points in the fit, oldest at head once the window is full. With x = 0
+// for the oldest point, sum_y and sum_xy are all the fit needs; sum_x and
+// sum_xx only depend on the point count.
+static int32_t  points[TREND_WINDOW];
+static uint16_t head;
+static uint16_t count;
+static int64_t  sum_y;
+static int64_t  sum_xy;
+
+static TREND_Estimate est;
+
+/* ======== Fit ======== */
+
+static void add_point(int32_t y)
+{
+    if (count < TREND_WINDOW) {
+        // New point at x = count, nothing shifts
+        sum_xy += (int64_t)count * y;
+        sum_y  += y;
+        points[(head + count) % TREND_WINDOW] = y;
+        count++;
+    } else {
+        // Drop x = 0, every other x goes down by one, new point at N - 1
+        int32_t old = points[head];
+        sum_y  -= old;
+        sum_xy -= sum_y;
+        sum_xy += (int64_t)(TREND_WINDOW - 1U) * y;
+        sum_y  += y;
+        points[head] = y;
+        head = (head + 1U) % TREND_WINDOW;
+    }
+
+    int64_t n   = count;
+    int64_t sx  = n * (n - 1) / 2;
+    int64_t sxx = (n - 1) * n * (2 * n - 1) / 6;
+    int64_t den = n * sxx - sx * sx;
+
+    est.points = count;
+    est.valid  = (count >= TREND_MIN_POINTS);
+    if (den == 0) {
+        est.slope = 0;
+        est.level = y;
+        return;
+    }
+
+    // Slope per point, then the line at the newest point
+    int64_t num   = n * sum_xy - sx * sum_y;
+    int64_t slope = num / den;
+    int64_t icpt  = (sum_y - slope * sx) / n;
+
+    est.level = (int32_t)(icpt + slope * (n - 1));
+    est.slope = (int32_t)(slope * (60000 / TREND_POINT_MS));
+}
+
+/* ======== Public API ======== */
+
+void TREND_Init(void)
+{
+    acc_sum   = 0;
+    acc_count = 0;
+    head      = 0;
+    count     = 0;
+    sum_y     = 0;
+    sum_xy    = 0;
+    est = (TREND_Estimate){0};
+}
+
+uint8_t TREND_AddSample(uint32_t tick, int32_t value)
+{
+    uint8_t closed = 0;
+
+    if (acc_count > 0U) {
+        uint32_t age = tick - acc_start;
+
+        if (age >= TREND_WINDOW * TREND_POINT_MS) {
+            // Nothing for a whole window: the old fit says nothing now
+            TREND_Init();
+        } else if (age >= TREND_POINT_MS) {
+            add_point((int32_t)(acc_sum / acc_count));
+            closed    = 1;
+            acc_sum   = 0;
+            acc_count = 0;
+        }
+    }
+
+    if (acc_count == 0U) {
+        acc_start = tick;
+    }
+    acc_sum += value;
+    acc_count++;
+    return closed;
+}
+
+void TREND_Get(TREND_Estimate *out)
+{
+    *out = est;
+}
+
+TREND_Limit TREND_Predict(int32_t lower, int32_t upper, uint32_t *seconds)
+{
+    *seconds = 0;
+    if (!est.valid) return TREND_LIMIT_NONE;
+
+    if (est.level <= lower) return TREND_LIMIT_LOW;
+    if (est.level >= upper) return TREND_LIMIT_HIGH;
+
+    int64_t gap;
+    TREND_Limit limit;
+
+    if (est.slope < 0) {
+        gap   = (int64_t)(est.level - lower) * 60 / -est.slope;
+        limit = TREND_LIMIT_LOW;
+    } else if (est.slope > 0) {
+        gap   = (int64_t)(upper - est.level) * 60 / est.slope;
+        limit = TREND_LIMIT_HIGH;
+    } else {
+        return TREND_LIMIT_NONE;
+    }
+
+    if (gap > TREND_HORIZON_S) return TREND_LIMIT_NONE;
+    *seconds = (uint32_t)gap;
+    return limit;
+}
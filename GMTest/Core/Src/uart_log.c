@@ -0,0 +1,178 @@
+/*
+ * uart_log.c
+ *
+ *  Created on: Oct 17, 2026
+ *      Author: kings
+ */
+
+#include "uart_log.h"
+#include "usart.h"
+#include <string.h>
+
+_Static_assert((ULOG_BUF_LEN & (ULOG_BUF_LEN - 1U)) == 0U,
+               "ULOG_BUF_LEN must be a power of two");
+_Static_assert(ULOG_BUF_LEN <= 0x8000U,
+               "one DMA transfer must cover the ring");
+
+/* The indices run freely and are masked on access. Bytes between tail and
+ * commit are ready to send, between commit and reserve still being copied
+ * by a writer.
+ */
+static uint8_t buf[ULOG_BUF_LEN];
+static volatile uint32_t reserve;   // end of the space handed to writers
+static volatile uint32_t commit;    // end of the bytes writers released
+static volatile uint32_t tail;      // advanced by the completion IRQ only
+static volatile uint32_t writers;   // writers between reserve and release
+static volatile uint32_t busy;      // a DMA transfer is in flight
+static volatile uint32_t sending;   // its length
+static volatile uint8_t  ready;
+static ULOG_Stats stats;
+
+/* ======== Atomics ======== */
+
+/* Single-shot compare and swap; fails too if an exception came in between
+ * (exception entry clears the exclusive monitor), so callers loop.
+ */
+static uint8_t cas(volatile uint32_t *p, uint32_t expect, uint32_t val)
+{
+    if (__LDREXW(p) != expect) {
+        __CLREX();
+        return 0;
+    }
+    return __STREXW(val, p) == 0;
+}
+
+static uint32_t atomic_add(volatile uint32_t *p, uint32_t n)
+{
+    uint32_t v;
+
+    do {
+        v = __LDREXW(p) + n;
+    } while (__STREXW(v, p));
+    return v;
+}
+
+/* ======== Transmit ======== */
+
+/* Sends the next contiguous run of released bytes, unless a transfer is
+ * already running; its completion IRQ picks the rest up then. If the UART
+ * is not ready yet the bytes stay put until the next write.
+ */
+static void kick(void)
+{
+    if (!ready || (commit == tail) || !cas(&busy, 0, 1)) return;
+
+    uint32_t t   = tail;
+    uint32_t off = t & (ULOG_BUF_LEN - 1U);
+    uint32_t len = commit - t;
+    if (len > ULOG_BUF_LEN - off) len = ULOG_BUF_LEN - off;
+
+    sending = len;
+    if (HAL_UART_Transmit_DMA(&huart4, &buf[off], (uint16_t)len) == HAL_OK) {
+        stats.transfers++;
+    } else {
+        busy = 0;
+    }
+}
+
+void HAL_UART_TxCpltCallback(UART_HandleTypeDef *huart)
+{
+    if (huart->Instance != UART4) return;
+
+    tail += sending;
+    busy = 0;
+    kick();
+}
+
+/* A DMA error ends the transfer with nothing sent as far as we know; send
+ * the chunk again.
+ */
+void HAL_UART_ErrorCallback(UART_HandleTypeDef *huart)
+{
+    if ((huart->Instance != UART4) || (huart->gState != HAL_UART_STATE_READY)) {
+        return;
+    }
+
+    busy = 0;
+    kick();
+}
+
+/* ======== Writers ======== */
+
+/* Writers preempt each other strictly nested, so the one that brings the
+ * count back to zero is the outermost and everything reserved so far has
+ * been copied. It publishes reserve as the new commit; a writer slipping
+ * in between the two reads changes commit and the swap retries.
+ */
+static void release(void)
+{
+    uint32_t c, r;
+
+    if (atomic_add(&writers, (uint32_t)-1) != 0U) return;
+
+    do {
+        c = commit;
+        r = reserve;
+    } while (!cas(&commit, c, r));
+
+    kick();
+}
+
+void ULOG_Init(void)
+{
+    ready = 1;
+    kick();
+}
+
+uint32_t ULOG_Write(const void *data, uint32_t len)
+{
+    uint32_t r, used;
+
+    if (len == 0) return 0;
+
+    atomic_add(&writers, 1);
+    do {
+        r = reserve;
+        used = r - tail;
+        if (len > ULOG_BUF_LEN - used) {
+            atomic_add(&stats.dropped, len);
+            release();
+            return 0;
+        }
+    } while (!cas(&reserve, r, r + len));
+
+    uint32_t off   = r & (ULOG_BUF_LEN - 1U);
+    uint32_t first = ULOG_BUF_LEN - off;
+    if (first > len) first = len;
+    memcpy(&buf[off], data, first);
+    memcpy(buf, (const uint8_t *)data + first, len - first);
+
+    atomic_add(&stats.written, len);
+    if (used + len > stats.high_water) {
+        stats.high_water = used + len;  // a racing writer may lose this one
+    }
+
+    release();
+    return len;
+}
+
+uint8_t ULOG_Flush(uint32_t timeout_ms)
+{
+    uint32_t start = HAL_GetTick();
+
+    kick();
+    while ((tail != commit) || busy) {
+        if (HAL_GetTick() - start >= timeout_ms) return 0;
+    }
+    return 1;
+}
+
+uint8_t ULOG_Busy(void)
+{
+    return (tail != commit) || busy;
+}
+
+void ULOG_GetStats(ULOG_Stats *s)
+{
+    *s = stats;
+}
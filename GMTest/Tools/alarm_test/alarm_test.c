@@ -0,0 +1,389 @@
+/*
+ * alarm_test.c
+ *
+ *  Created on: Oct 17, 2026
+ *      Author: kings
+ *
+ *  Walks the glucose alarm state machines (alarm.c) through scripted
+ *  readings on a simulated millisecond clock, with main.c's settings.
+ *  Checks
+ *
+ *    - debounce: a condition shorter than on_delay_ms never sounds, one
+ *      held that long does, and a zero delay sounds at once;
+ *    - min_on_ms: an alarm stays on that long however soon it clears;
+ *    - the level and rate hysteresis bands;
+ *    - silencing: Alarm_Acknowledge, silence_ms running out with the
+ *      condition still on, and clearing while silenced;
+ *    - predicted crossings setting and holding LOW and HIGH, and
+ *      predict_s = 0 turning them off;
+ *    - the bits Alarm_Update returns, severity order, the tick wrapping.
+ *
+ *      alarm_test
+ *
+ *  Exits non-zero on the first failed check.
+ */
+
+#include "alarm.h"
+
+#include <stdio.h>
+#include <string.h>
+
+#define MG(v)           ((int32_t)((v) * 65536.0))     // mg/dL (/min) in Q16
+#define READING_MS      5000U                          // between readings
+
+static uint32_t failures;
+
+#define CHECK(cond, ...) do {                                   \
+        if (!(cond)) {                                          \
+            printf("FAIL %s:%d: ", __FILE__, __LINE__);         \
+            printf(__VA_ARGS__);                                \
+            printf("\n");                                       \
+            failures++;                                         \
+            return;                                             \
+        }                                                       \
+    } while (0)
+
+/* As main.c, with 70..180 mg/dL limits */
+static const Alarm_Config main_cfg = {
+    .lower       = MG(70),
+    .upper       = MG(180),
+    .level_hyst  = MG(5),
+    .rate_limit  = MG(2),
+    .rate_hyst   = MG(0.5),
+    .predict_s   = 15 * 60,
+    .on_delay_ms = 15000,
+    .min_on_ms   = 60000,
+    .silence_ms  = 15 * 60000,
+};
+
+static const char *const state_names[] = {
+    "idle", "pending", "active", "silenced"
+};
+
+/* ======== Readings ======== */
+
+static uint32_t now;
+static uint8_t  changed;
+
+static void reading(double mgdl, double slope, TREND_Limit predicted,
+                    uint32_t predict_s)
+{
+    Alarm_Input in = {
+        .value       = MG(mgdl),
+        .slope       = MG(slope),
+        .slope_valid = 1,
+        .predicted   = predicted,
+        .predict_s   = predict_s,
+    };
+    changed = Alarm_Update(now, &in);
+}
+
+static void level(double mgdl)
+{
+    reading(mgdl, 0.0, TREND_LIMIT_NONE, 0);
+}
+
+/* Readings of one level every READING_MS for ms, starting now */
+static void hold(double mgdl, uint32_t ms)
+{
+    for (uint32_t t = 0; t < ms; t += READING_MS) {
+        level(mgdl);
+        now += READING_MS;
+    }
+}
+
+static void start(const Alarm_Config *cfg, uint32_t t0)
+{
+    Alarm_Init(cfg);
+    now = t0;
+    changed = 0;
+}
+
+#define EXPECT(kind, st) \
+    CHECK(Alarm_GetState(kind) == (st), "%s at %u ms: %s, expected %s", \
+          Alarm_Name(kind), now, state_names[Alarm_GetState(kind)], state_names[st])
+
+/* ======== Scenarios ======== */
+
+static void test_debounce(void)
+{
+    start(&main_cfg, 1000);
+
+    // Low for 10 s of a 15 s delay: pending, then back to idle
+    level(65);
+    EXPECT(ALARM_LOW, ALARM_PENDING);
+    CHECK(changed == (1U << ALARM_LOW), "changed 0x%X entering pending", changed);
+    now += READING_MS;
+    level(65);
+    CHECK(changed == 0U, "changed 0x%X staying pending", changed);
+    now += READING_MS;
+    level(72);
+    EXPECT(ALARM_LOW, ALARM_IDLE);
+    CHECK(changed == (1U << ALARM_LOW), "changed 0x%X dropping pending", changed);
+    CHECK(Alarm_Sounding() == ALARM_NONE, "sounding after a blip");
+
+    // Held: active on the first reading 15 s after it was seen
+    now += READING_MS;
+    uint32_t seen = now;
+    hold(65, 15000);
+    EXPECT(ALARM_LOW, ALARM_PENDING);
+    level(65);
+    CHECK(now - seen == 15000U, "checked at %u ms", now - seen);
+    EXPECT(ALARM_LOW, ALARM_ACTIVE);
+    CHECK(changed == (1U << ALARM_LOW), "changed 0x%X going active", changed);
+    CHECK(Alarm_Sounding() == ALARM_LOW, "sounding %s",
+          Alarm_Name(Alarm_Sounding()));
+    EXPECT(ALARM_HIGH, ALARM_IDLE);
+    EXPECT(ALARM_RAPID, ALARM_IDLE);
+
+    // No delay: idle to active in one reading
+    Alarm_Config cfg = main_cfg;
+    cfg.on_delay_ms = 0;
+    start(&cfg, 1000);
+    level(190);
+    EXPECT(ALARM_HIGH, ALARM_ACTIVE);
+    CHECK(changed == (1U << ALARM_HIGH), "changed 0x%X with no delay", changed);
+
+    printf("debounce: OK\n");
+}
+
+static void test_min_on(void)
+{
+    start(&main_cfg, 1000);
+    hold(190, 15000);
+    level(190);
+    EXPECT(ALARM_HIGH, ALARM_ACTIVE);
+    uint32_t on = now;
+
+    // Well back in range at once: held until min_on_ms has passed
+    while (now - on < main_cfg.min_on_ms) {
+        EXPECT(ALARM_HIGH, ALARM_ACTIVE);
+        now += READING_MS;
+        level(120);
+    }
+    CHECK(now - on == main_cfg.min_on_ms, "stepped to %u ms", now - on);
+    EXPECT(ALARM_HIGH, ALARM_IDLE);
+    CHECK(changed == (1U << ALARM_HIGH), "changed 0x%X clearing", changed);
+
+    printf("min on: OK\n");
+}
+
+static void test_hysteresis(void)
+{
+    start(&main_cfg, 1000);
+    hold(60, 80000);
+    EXPECT(ALARM_LOW, ALARM_ACTIVE);
+
+    // Above the limit but inside the 5 mg/dL band: still on
+    hold(72, 30000);
+    EXPECT(ALARM_LOW, ALARM_ACTIVE);
+    level(75);                      // the band edge is not past it
+    EXPECT(ALARM_LOW, ALARM_ACTIVE);
+    now += READING_MS;
+    level(75.1);
+    EXPECT(ALARM_LOW, ALARM_IDLE);
+
+    // The same for HIGH, from above
+    hold(200, 80000);
+    EXPECT(ALARM_HIGH, ALARM_ACTIVE);
+    hold(176, 30000);
+    EXPECT(ALARM_HIGH, ALARM_ACTIVE);
+    level(174.9);
+    EXPECT(ALARM_HIGH, ALARM_IDLE);
+
+    // Rate: on past 2 mg/dL/min either way, off under 1.5
+    start(&main_cfg, 1000);
+    for (uint32_t i = 0; i < 4U; i++) {
+        reading(120, -2.5, TREND_LIMIT_NONE, 0);
+        now += READING_MS;
+    }
+    EXPECT(ALARM_RAPID, ALARM_ACTIVE);
+    for (uint32_t i = 0; i < 12U; i++) {
+        reading(120, 1.6, TREND_LIMIT_NONE, 0);
+        now += READING_MS;
+    }
+    EXPECT(ALARM_RAPID, ALARM_ACTIVE);
+    reading(120, 1.4, TREND_LIMIT_NONE, 0);
+    EXPECT(ALARM_RAPID, ALARM_IDLE);
+
+    // No valid slope (trend window still filling): never on, and clears
+    start(&main_cfg, 1000);
+    Alarm_Input in = { .value = MG(120), .slope = MG(9), .slope_valid = 0 };
+    for (uint32_t i = 0; i < 6U; i++, now += READING_MS) Alarm_Update(now, &in);
+    EXPECT(ALARM_RAPID, ALARM_IDLE);
+    for (uint32_t i = 0; i < 16U; i++) {
+        reading(120, 3.0, TREND_LIMIT_NONE, 0);
+        now += READING_MS;
+    }
+    EXPECT(ALARM_RAPID, ALARM_ACTIVE);
+    Alarm_Update(now, &in);
+    EXPECT(ALARM_RAPID, ALARM_IDLE);
+
+    printf("hysteresis: OK\n");
+}
+
+static void test_silence(void)
+{
+    start(&main_cfg, 1000);
+    hold(60, 20000);
+    EXPECT(ALARM_LOW, ALARM_ACTIVE);
+
+    // A pending alarm is not silenced ahead of time
+    hold(190, 5000);
+    EXPECT(ALARM_HIGH, ALARM_PENDING);
+    Alarm_Acknowledge(now);
+    EXPECT(ALARM_LOW, ALARM_SILENCED);
+    EXPECT(ALARM_HIGH, ALARM_PENDING);
+
+    // Silenced, still low: quiet for silence_ms, then sounding again
+    start(&main_cfg, 1000);
+    hold(60, 20000);
+    EXPECT(ALARM_LOW, ALARM_ACTIVE);
+    Alarm_Acknowledge(now);
+    uint32_t acked = now;
+    EXPECT(ALARM_LOW, ALARM_SILENCED);
+    CHECK(Alarm_Sounding() == ALARM_NONE, "sounding while silenced");
+    while (now - acked + READING_MS < main_cfg.silence_ms) {
+        now += READING_MS;
+        level(60);
+        EXPECT(ALARM_LOW, ALARM_SILENCED);
+        CHECK(changed == 0U, "changed 0x%X while silenced", changed);
+    }
+    now += READING_MS;
+    level(60);
+    CHECK(now - acked == main_cfg.silence_ms, "stepped to %u ms", now - acked);
+    EXPECT(ALARM_LOW, ALARM_ACTIVE);
+    CHECK(changed == (1U << ALARM_LOW), "changed 0x%X silence over", changed);
+    CHECK(Alarm_Sounding() == ALARM_LOW, "not sounding after the silence");
+
+    // Silenced and recovered before it runs out: straight to idle
+    Alarm_Acknowledge(now);
+    now += READING_MS;
+    level(90);
+    EXPECT(ALARM_LOW, ALARM_IDLE);
+
+    // Silence ran out inside the band: not cleared, so it sounds again
+    start(&main_cfg, 1000);
+    hold(60, 20000);
+    Alarm_Acknowledge(now);
+    hold(72, main_cfg.silence_ms);
+    level(72);
+    EXPECT(ALARM_LOW, ALARM_ACTIVE);
+
+    printf("silence: OK\n");
+}
+
+static void test_predictive(void)
+{
+    start(&main_cfg, 1000);
+
+    // In range, but heading below the limit
+    reading(95, -1.5, TREND_LIMIT_LOW, 20 * 60);
+    EXPECT(ALARM_LOW, ALARM_IDLE);
+    for (uint32_t i = 0; i < 4U; i++) {
+        reading(95, -1.5, TREND_LIMIT_LOW, 14 * 60);
+        now += READING_MS;
+    }
+    EXPECT(ALARM_LOW, ALARM_ACTIVE);
+    EXPECT(ALARM_HIGH, ALARM_IDLE);
+
+    // Still predicted, well in range and past min_on: held on
+    for (uint32_t i = 0; i < 16U; i++) {
+        reading(100, -1.0, TREND_LIMIT_LOW, 14 * 60);
+        now += READING_MS;
+    }
+    EXPECT(ALARM_LOW, ALARM_ACTIVE);
+    reading(100, -1.0, TREND_LIMIT_LOW, 16 * 60);
+    EXPECT(ALARM_LOW, ALARM_IDLE);
+
+    // Heading up: HIGH, and the prediction alone does not touch LOW
+    start(&main_cfg, 1000);
+    for (uint32_t i = 0; i < 4U; i++) {
+        reading(150, 1.5, TREND_LIMIT_HIGH, 5 * 60);
+        now += READING_MS;
+    }
+    EXPECT(ALARM_HIGH, ALARM_ACTIVE);
+    EXPECT(ALARM_LOW, ALARM_IDLE);
+    for (uint32_t i = 0; i < 12U; i++) {
+        reading(150, 0.0, TREND_LIMIT_NONE, 0);
+        now += READING_MS;
+    }
+    EXPECT(ALARM_HIGH, ALARM_IDLE);
+
+    // predict_s = 0 turns prediction off, even for a crossing due now
+    Alarm_Config cfg = main_cfg;
+    cfg.predict_s = 0;
+    start(&cfg, 1000);
+    for (uint32_t i = 0; i < 8U; i++) {
+        reading(95, -1.5, TREND_LIMIT_LOW, 0);
+        now += READING_MS;
+    }
+    EXPECT(ALARM_LOW, ALARM_IDLE);
+
+    printf("predictive: OK\n");
+}
+
+static void test_severity(void)
+{
+    start(&main_cfg, 1000);
+
+    // Falling fast and low: both on, LOW is heard first
+    for (uint32_t i = 0; i < 4U; i++) {
+        reading(60, -3.0, TREND_LIMIT_NONE, 0);
+        now += READING_MS;
+    }
+    EXPECT(ALARM_LOW, ALARM_ACTIVE);
+    EXPECT(ALARM_RAPID, ALARM_ACTIVE);
+    CHECK(Alarm_Sounding() == ALARM_LOW, "sounding %s",
+          Alarm_Name(Alarm_Sounding()));
+
+    // Acknowledge silences every active alarm
+    Alarm_Acknowledge(now);
+    EXPECT(ALARM_LOW, ALARM_SILENCED);
+    EXPECT(ALARM_RAPID, ALARM_SILENCED);
+    CHECK(Alarm_Sounding() == ALARM_NONE, "sounding while all silenced");
+
+    CHECK(strcmp(Alarm_Name(ALARM_NONE), "none") == 0, "name of none: %s",
+          Alarm_Name(ALARM_NONE));
+    CHECK(strcmp(Alarm_Name((Alarm_Kind)200), "none") == 0,
+          "name out of range: %s", Alarm_Name((Alarm_Kind)200));
+    CHECK(Alarm_GetState((Alarm_Kind)200) == ALARM_IDLE, "state out of range");
+
+    printf("severity: OK\n");
+}
+
+/* HAL_GetTick wraps after 49.7 days; every interval is a difference */
+static void test_wrap(void)
+{
+    start(&main_cfg, 0xFFFFFFFFU - 7000U);
+
+    hold(60, 10000);
+    EXPECT(ALARM_LOW, ALARM_PENDING);
+    CHECK(now < 10000U, "clock did not wrap: %u", now);
+    hold(60, 5000);
+    level(60);
+    EXPECT(ALARM_LOW, ALARM_ACTIVE);
+    uint32_t on = now;
+    now += READING_MS;
+    hold(90, main_cfg.min_on_ms - READING_MS);
+    EXPECT(ALARM_LOW, ALARM_ACTIVE);
+    level(90);
+    CHECK(now - on == main_cfg.min_on_ms, "stepped to %u ms", now - on);
+    EXPECT(ALARM_LOW, ALARM_IDLE);
+
+    printf("wrap: OK\n");
+}
+
+int main(void)
+{
+    test_debounce();
+    test_min_on();
+    test_hysteresis();
+    test_silence();
+    test_predictive();
+    test_severity();
+    test_wrap();
+
+    printf(failures ? "\nFAILED\n" : "\nOK\n");
+    return failures ? 1 : 0;
+}
@@ -0,0 +1,321 @@
+/*
+ * cal_test.c
+ *
+ *  Created on: Oct 17, 2026
+ *      Author: kings
+ *
+ *  Sweeps every 16-bit raw value through the glucose calibration
+ *  (glucose_cal.c) for a set of test curves and sensor temperatures, and
+ *  compares each result with the same curve worked out in double
+ *  precision. Covers
+ *
+ *    - piecewise-linear curves: segment choice, extrapolation past the end
+ *      knots, steep segments, a negative offset;
+ *    - polynomial curves up to CAL_MAX_POINTS coefficients (Horner);
+ *    - the temperature gain on both sides of temp_ref, out to its 16x
+ *      clamps, and the clamp of the result at zero;
+ *    - CAL_Load refusing damaged or malformed records.
+ *
+ *  Each conversion must be within an error budget worked out from the
+ *  integer arithmetic (below); the largest error per curve is printed in
+ *  Q16 steps and mg/dL.
+ *
+ *      cal_test
+ *
+ *  Exits non-zero on the first failed check.
+ */
+
+#include "glucose_cal.h"
+#include "main.h"
+
+#include <math.h>
+#include <stdio.h>
+
+#define Q16(v)          ((int32_t)((v) * 65536.0))
+
+SIM_DWT_Type SIM_DWT;
+
+static uint32_t failures;
+
+#define CHECK(cond, ...) do {                                   \
+        if (!(cond)) {                                          \
+            printf("FAIL %s:%d: ", __FILE__, __LINE__);         \
+            printf(__VA_ARGS__);                                \
+            printf("\n");                                       \
+            failures++;                                         \
+            return;                                             \
+        }                                                       \
+    } while (0)
+
+/* ======== Test curves ======== */
+
+typedef struct {
+    const char *name;
+    CAL_Record  rec;
+} TestCurve;
+
+static const TestCurve curves[] = {
+    {   "pwl 8 knots, saturating", {
+        .curve = CAL_CURVE_PWL, .npoints = 8, .offset = 800,
+        .x = { 2000, 6000, 12000, 20000, 30000, 42000, 52000, 60000 },
+        .y = { Q16(20), Q16(45), Q16(90), Q16(150),
+               Q16(225), Q16(320), Q16(400), Q16(470) },
+        .temp_ref = 370, .temp_coef = Q16(0.03),
+    } },
+    {   "pwl steep start", {
+        // 12.5 mg/dL a count at first; below it extrapolates under zero
+        .curve = CAL_CURVE_PWL, .npoints = 3, .offset = -500,
+        .x = { 1000, 1016, 64000 },
+        .y = { 0, Q16(200), Q16(600) },
+        .temp_ref = 250, .temp_coef = Q16(-0.02),
+    } },
+    {   "pwl steep end", {
+        // Past the last knot it climbs out of 32 bits once the gain is 16x
+        .curve = CAL_CURVE_PWL, .npoints = 3, .offset = 0,
+        .x = { 0, 65000, 65016 },
+        .y = { 0, Q16(600), Q16(800) },
+        .temp_ref = 370, .temp_coef = Q16(0.03),
+    } },
+    {   "poly quadratic", {
+        .curve = CAL_CURVE_POLY, .npoints = 3, .offset = 300,
+        .y = { Q16(-5), Q16(700), Q16(-150) },
+        .temp_ref = 370, .temp_coef = Q16(0.03),
+    } },
+    {   "poly 8 terms", {
+        .curve = CAL_CURVE_POLY, .npoints = 8, .offset = 0,
+        .y = { Q16(10), Q16(400), Q16(300), Q16(-500),
+               Q16(200), Q16(100), Q16(-50), Q16(20.5) },
+        .temp_ref = 370, .temp_coef = Q16(0.01),
+    } },
+};
+
+/* Sensor temperatures, 0.1 degC: the bedside range in odd steps, then
+ * far enough out to reach the gain clamps with each curve's temp_coef
+ */
+static int16_t temps[64];
+static uint32_t n_temps;
+
+static void make_temps(void)
+{
+    static const int16_t extremes[] = { -400, -100, 0, 1000, 5400, 12000 };
+
+    for (int16_t t = 150; t <= 450; t += 7) temps[n_temps++] = t;
+    for (uint32_t i = 0; i < sizeof(extremes) / sizeof(extremes[0]); i++) {
+        temps[n_temps++] = extremes[i];
+    }
+}
+
+/* ======== Reference ======== */
+
+/* The curve alone, in Q16 units, and what the firmware's rounding may add
+ * to it: half a step for the PWL rounding plus the truncated Q24 slope (at
+ * most one Q24 step per count from the knot), or one step per Horner
+ * stage for a polynomial.
+ */
+static double ref_curve(const CAL_Record *r, int32_t x, double *budget)
+{
+    if (r->curve == CAL_CURVE_PWL) {
+        uint8_t i = 0;
+        while ((i + 2U < r->npoints) && (x >= r->x[i + 1])) i++;
+
+        double dx = (double)x - r->x[i];
+        *budget = 0.5 + fabs(dx) / 256.0;
+        return r->y[i] + (double)(r->y[i + 1] - r->y[i]) * dx /
+                         ((double)r->x[i + 1] - r->x[i]);
+    }
+
+    double u = x / 65536.0, y = 0.0, p = 1.0;
+    for (uint8_t k = 0; k < r->npoints; k++) {
+        y += r->y[k] * p;
+        p *= u;
+    }
+    *budget = r->npoints - 1U;
+    return y;
+}
+
+/* The temperature gain in Q16 units, clamped to 16x either way, and the
+ * most the firmware's 1 / gain (Q16, from a gain truncated to a step) can
+ * be off it
+ */
+static double ref_inv_gain(const CAL_Record *r, int16_t temp, double *err)
+{
+    double g = 65536.0 + (double)r->temp_coef * (temp - r->temp_ref) / 10.0;
+
+    if (g < 4096.0) g = 4096.0;
+    if (g > 1048576.0) g = 1048576.0;
+
+    double inv = 4294967296.0 / g;
+    *err = ((g != floor(g)) ? inv / (g - 1.0) : 0.0) +
+           ((inv != floor(inv)) ? 1.0 : 0.0);
+    return inv;
+}
+
+/* ======== Checks ======== */
+
+typedef struct {
+    double max_err;     // Q16 steps
+    double max_budget;
+    uint32_t at_raw;
+    int16_t  at_temp;
+    uint32_t clamped;   // results held at zero
+    uint32_t saturated; // and at INT32_MAX
+} SweepResult;
+
+static void sweep(const CAL_Record *r, SweepResult *res)
+{
+    *res = (SweepResult){0};
+
+    for (uint32_t t = 0; t < n_temps; t++) {
+        double inv_err;
+        double inv = ref_inv_gain(r, temps[t], &inv_err);
+
+        CAL_SetTemperature(temps[t]);
+        for (uint32_t raw = 0; raw <= 0xFFFFU; raw++) {
+            int32_t x = (int32_t)raw - r->offset;
+            if (x < 0) x = 0;
+            if (x > 0xFFFF) x = 0xFFFF;
+
+            double curve_err;
+            double y = ref_curve(r, x, &curve_err);
+            double want = y * inv / 65536.0;
+            if (want < 0.0) want = 0.0;
+            if (want > INT32_MAX) want = INT32_MAX;
+
+            // Curve error through the gain, gain error on the curve, the
+            // final shift
+            double budget = curve_err * (inv + inv_err) / 65536.0 +
+                            fabs(y) * inv_err / 65536.0 + 1.0;
+
+            int32_t got = CAL_Convert((uint16_t)raw);
+            double err = fabs(got - want);
+
+            CHECK(err <= budget, "raw %u at %d.%d degC: %d, expected %.1f "
+                  "(off %.1f, budget %.1f)", raw, temps[t] / 10,
+                  (temps[t] < 0 ? -temps[t] : temps[t]) % 10, got, want,
+                  err, budget);
+            if (err > res->max_err) {
+                res->max_err    = err;
+                res->max_budget = budget;
+                res->at_raw     = raw;
+                res->at_temp    = temps[t];
+            }
+            res->clamped += (got == 0) && (y < 0.0);
+            res->saturated += (got == INT32_MAX);
+        }
+    }
+}
+
+static void report(const char *name, const SweepResult *res)
+{
+    printf("  %-26s max error %7.1f (%.5f mg/dL, budget %.1f) at raw %5u, "
+           "%d.%d degC; %u held at 0, %u saturated\n", name, res->max_err,
+           res->max_err / 65536.0, res->max_budget, res->at_raw,
+           res->at_temp / 10, (res->at_temp < 0 ? -res->at_temp : res->at_temp) % 10,
+           res->clamped, res->saturated);
+}
+
+static void test_default(void)
+{
+    SweepResult res;
+    CAL_Record r;
+
+    CAL_Init();
+    r = *CAL_Get();
+    sweep(&r, &res);
+    if (failures) return;
+    report("default (placeholder)", &res);
+}
+
+static void test_curves(void)
+{
+    for (uint32_t c = 0; c < sizeof(curves) / sizeof(curves[0]); c++) {
+        CAL_Record r = curves[c].rec;
+        SweepResult res;
+
+        r.magic   = CAL_MAGIC;
+        r.version = CAL_VERSION;
+        r.serial  = c + 1U;
+        CAL_Seal(&r);
+        CHECK(CAL_Load(&r), "%s: refused", curves[c].name);
+
+        sweep(&r, &res);
+        if (failures) return;
+        report(curves[c].name, &res);
+
+        // At temp_ref the gain is exactly one: only the curve's own error
+        CAL_SetTemperature(r.temp_ref);
+        for (uint32_t raw = 0; raw <= 0xFFFFU; raw += 257U) {
+            int32_t x = (int32_t)raw - r.offset;
+            if (x < 0) x = 0;
+            if (x > 0xFFFF) x = 0xFFFF;
+
+            double budget;
+            double want = ref_curve(&r, x, &budget);
+            if (want < 0.0) want = 0.0;
+            int32_t got = CAL_Convert((uint16_t)raw);
+
+            CHECK(fabs(got - want) <= budget, "%s: raw %u at temp_ref: %d, "
+                  "expected %.1f", curves[c].name, raw, got, want);
+        }
+    }
+}
+
+static void expect_refused(const char *what, CAL_Record r)
+{
+    const CAL_Record before = *CAL_Get();
+
+    CAL_Seal(&r);
+    CHECK(!CAL_Load(&r), "CAL_Load took a record with %s", what);
+    CHECK(CAL_Get()->serial == before.serial,
+          "refusing a record with %s replaced the active one", what);
+}
+
+static void test_load(void)
+{
+    CAL_Record good = curves[0].rec;
+    CAL_Record r;
+
+    good.magic   = CAL_MAGIC;
+    good.version = CAL_VERSION;
+    good.serial  = 100;
+    CAL_Seal(&good);
+    CHECK(CAL_Load(&good), "good record refused");
+
+    r = good;
+    r.serial = 101;
+    CHECK(!CAL_Load(&r), "CAL_Load took a record with a stale CRC");
+
+    r = good; r.magic = 0;                  expect_refused("a bad magic", r);
+    r = good; r.version = CAL_VERSION + 1U; expect_refused("a new version", r);
+    r = good; r.curve = 2;                  expect_refused("no such curve", r);
+    r = good; r.npoints = 1;                expect_refused("one knot", r);
+    r = good; r.npoints = CAL_MAX_POINTS + 1U;
+    expect_refused("too many knots", r);
+    r = good; r.x[3] = r.x[2];              expect_refused("a repeated knot", r);
+    r = good; r.x[3] = r.x[2] - 1U;         expect_refused("knots out of order", r);
+
+    // One count to 256 mg/dL: a Q24 slope of 2^32
+    r = good; r.x[1] = r.x[0] + 1U; r.y[1] = r.y[0] + Q16(256);
+    expect_refused("a slope past 32 bits", r);
+
+    // A rise that wraps in 32 bits (to -1) must not pass as a shallow slope
+    r = good; r.x[1] = r.x[0] + 1U; r.y[0] = INT32_MIN; r.y[1] = INT32_MAX;
+    expect_refused("a rise past 32 bits", r);
+
+    r = good; r.curve = CAL_CURVE_POLY; r.npoints = 0;
+    expect_refused("no coefficients", r);
+}
+
+int main(void)
+{
+    make_temps();
+
+    printf("%u raw values at %u temperatures per curve (Q16 steps)\n",
+           0x10000U, n_temps);
+    test_default();
+    if (!failures) test_curves();
+    if (!failures) test_load();
+
+    printf(failures ? "FAILED\n" : "OK\n");
+    return failures ? 1 : 0;
+}
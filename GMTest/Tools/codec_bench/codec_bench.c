@@ -0,0 +1,257 @@
+/*
+ * codec_bench.c
+ *
+ *  Created on: Oct 17, 2026
+ *      Author: kings
+ *
+ *  Round-trips synthetic reading streams through the session log codec
+ *  (log_codec.c) and reports what they cost in flash against one plain
+ *  16-byte log entry per reading, and encode/decode time per reading.
+ *
+ *      codec_bench [readings [seed]]
+ *
+ *  Exits non-zero if any reading comes back different, or the decoder
+ *  takes a damaged block without complaint when it should not.
+ */
+
+#include "log_codec.h"
+
+#include <math.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#if defined(__x86_64__) || defined(__i386__)
+#include <x86intrin.h>
+#define CYCLES_NAME "TSC"
+#else
+#define CYCLES_NAME "n/a"
+#endif
+
+#define ENTRY_HDR       8U      // flash_log entry header
+#define PLAIN_ENTRY     16U     // {tick, filt16, flags} as one entry
+#define RAW_READING     6U      // u32 tick + u16 value, no framing
+
+static LOGC_Sample *input;
+static uint32_t n_input;
+
+static uint8_t  *blocks;        // every block, each after its u16 length
+static uint32_t blocks_len;
+static uint32_t n_blocks;
+static uint32_t flash_bytes;    // as flash_log would store them
+static uint32_t failures;
+
+static uint32_t rng = 1;
+
+static uint32_t rnd(void)
+{
+    rng ^= rng << 13;
+    rng ^= rng >> 17;
+    rng ^= rng << 5;
+    return rng;
+}
+
+static double gauss(void)
+{
+    double u = (rnd() + 1.0) / 4294967297.0;
+    double v = (rnd() + 1.0) / 4294967297.0;
+    return sqrt(-2.0 * log(u)) * cos(6.283185307179586 * v);
+}
+
+static void sink(const uint8_t *block, uint16_t len)
+{
+    if (len > LOGC_MAX_BLOCK) {
+        printf("FAIL block of %u bytes\n", len);
+        failures++;
+    }
+    memcpy(&blocks[blocks_len], &len, 2);
+    memcpy(&blocks[blocks_len + 2], block, len);
+    blocks_len += 2U + len;
+    n_blocks++;
+    flash_bytes += ENTRY_HDR + ((len + 7U) & ~7U);
+}
+
+/* ======== Signals ======== */
+
+typedef enum {
+    SIG_STEADY,         // slow glucose drift, light noise
+    SIG_NOISY,          // the same with heavy noise
+    SIG_IRREGULAR,      // dropped blocks and flag changes now and then
+    SIG_SPOT,           // steady, one spot reading per 5 s
+    SIG_RANDOM,         // full-scale random: the worst case
+} Signal;
+
+static const char *const signal_names[] = {
+    "steady (noise 4)", "noisy (noise 40)", "irregular", "spot (5 s)", "random"
+};
+
+static void make_signal(Signal sig, uint32_t n)
+{
+    uint32_t tick = 1000;
+    uint16_t flags = 0;
+
+    for (uint32_t i = 0; i < n; i++) {
+        // 100 mg/dL +- 40 over 90 min, about 150 counts a mg/dL
+        double drift = 32768.0 + 6000.0 * sin(i * 6.283185307179586 / 10800.0);
+        double v;
+
+        switch (sig) {
+        case SIG_STEADY:    v = drift + 4.0 * gauss(); break;
+        case SIG_NOISY:     v = drift + 40.0 * gauss(); break;
+        case SIG_IRREGULAR: v = drift + 4.0 * gauss(); break;
+        case SIG_SPOT:      v = drift + 4.0 * gauss(); break;
+        default:            v = rnd() & 0xFFFF; break;
+        }
+        if (v < 0) v = 0;
+        if (v > 65535) v = 65535;
+
+        if (sig == SIG_IRREGULAR) {
+            if (rnd() % 200U == 0U) tick += 500U * (1U + rnd() % 5U);  // lost blocks
+            if (rnd() % 500U == 0U) flags ^= 1U << (rnd() % 4U);
+        }
+        input[i] = (LOGC_Sample){ .tick = tick, .value = (uint16_t)v, .flags = flags };
+        tick += (sig == SIG_SPOT) ? 5000U : 500U;
+    }
+    n_input = n;
+}
+
+/* ======== Runs ======== */
+
+static uint64_t now_ns(void)
+{
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (uint64_t)ts.tv_sec * 1000000000U + ts.tv_nsec;
+}
+
+static uint64_t cycles(void)
+{
+#if defined(__x86_64__) || defined(__i386__)
+    return __rdtsc();
+#else
+    return 0;
+#endif
+}
+
+static void run(Signal sig, uint32_t n)
+{
+    static LOGC_Encoder enc;
+    static LOGC_Sample  out[LOGC_MAX_SAMPLES];
+    LOGC_Stats st;
+
+    make_signal(sig, n);
+    blocks_len = n_blocks = flash_bytes = 0;
+
+    LOGC_Init(&enc, sink);
+    uint64_t t0 = now_ns(), c0 = cycles();
+    for (uint32_t i = 0; i < n_input; i++) {
+        LOGC_Add(&enc, input[i].tick, input[i].value, input[i].flags);
+    }
+    LOGC_Flush(&enc);
+    uint64_t enc_ns = now_ns() - t0, enc_cyc = cycles() - c0;
+    LOGC_GetStats(&enc, &st);
+
+    // Decode everything back, and compare
+    uint32_t k = 0, off = 0;
+    t0 = now_ns();
+    c0 = cycles();
+    while (off < blocks_len) {
+        uint16_t len;
+        memcpy(&len, &blocks[off], 2);
+        uint8_t m = LOGC_Decode(&blocks[off + 2], len, out, LOGC_MAX_SAMPLES);
+        if (m == 0U) {
+            printf("FAIL %s: block at %u rejected\n", signal_names[sig], off);
+            failures++;
+            return;
+        }
+        for (uint8_t j = 0; j < m; j++, k++) {
+            if ((k >= n_input) || memcmp(&out[j], &input[k], sizeof(out[j]))) {
+                printf("FAIL %s: reading %u differs\n", signal_names[sig], k);
+                failures++;
+                return;
+            }
+        }
+        off += 2U + len;
+    }
+    uint64_t dec_ns = now_ns() - t0, dec_cyc = cycles() - c0;
+
+    if ((k != n_input) || (st.samples != n_input) || (st.blocks != n_blocks)) {
+        printf("FAIL %s: %u of %u readings back\n", signal_names[sig], k, n_input);
+        failures++;
+        return;
+    }
+
+    double per = (double)flash_bytes / n_input;
+    printf("%-18s %6u %8.2f %8.2f %7.1fx %6.1fx %6.1f %6.1f %6.1f %6.1f\n",
+           signal_names[sig], n_blocks, (double)st.bytes / n_input, per,
+           PLAIN_ENTRY / per, RAW_READING / per,
+           (double)enc_ns / n_input, (double)dec_ns / n_input,
+           (double)enc_cyc / n_input, (double)dec_cyc / n_input);
+}
+
+/* Damaged blocks: the decoder must never read past len, and must refuse
+ * anything whose length does not add up.
+ */
+static void fuzz(uint32_t rounds)
+{
+    static LOGC_Encoder enc;
+    LOGC_Sample out[LOGC_MAX_SAMPLES];
+    uint8_t buf[LOGC_MAX_BLOCK + 16];
+    uint32_t refused = 0, cut_taken = 0;
+
+    make_signal(SIG_NOISY, 4000);
+    blocks_len = n_blocks = flash_bytes = 0;
+    LOGC_Init(&enc, sink);
+    for (uint32_t i = 0; i < n_input; i++) {
+        LOGC_Add(&enc, input[i].tick, input[i].value, input[i].flags);
+    }
+    LOGC_Flush(&enc);
+
+    for (uint32_t r = 0; r < rounds; r++) {
+        uint16_t len;
+        memcpy(&len, &blocks[0], 2);
+        memcpy(buf, &blocks[2], len);
+
+        // Truncated: always refused
+        uint16_t cut = rnd() % len;
+        if (LOGC_Decode(buf, cut, out, LOGC_MAX_SAMPLES) != 0U) cut_taken++;
+
+        // Random bytes: refused or not, but never out of bounds (run
+        // under -fsanitize=address to see that)
+        uint16_t l = rnd() % sizeof(buf);
+        for (uint16_t i = 0; i < l; i++) buf[i] = rnd();
+        if (l > 11U) buf[11] = (rnd() & 1U) ? LOGC_VARINT : buf[11] % 17U;
+        if (LOGC_Decode(buf, l, out, LOGC_MAX_SAMPLES) == 0U) refused++;
+    }
+    if (cut_taken) {
+        printf("FAIL %u truncated blocks decoded\n", cut_taken);
+        failures++;
+    }
+    printf("fuzz: %u damaged blocks, %u random ones refused\n", rounds, refused);
+}
+
+int main(int argc, char **argv)
+{
+    uint32_t n    = (argc > 1) ? (uint32_t)strtoul(argv[1], NULL, 0) : 200000U;
+    uint32_t seed = (argc > 2) ? (uint32_t)strtoul(argv[2], NULL, 0) : 1U;
+
+    rng = seed ? seed : 1U;
+    input  = malloc(n * sizeof(*input) + 4000U * sizeof(*input));
+    blocks = malloc(n * 4U + 8000U * 4U + 65536U);
+    if (!input || !blocks) return 2;
+
+    printf("%u readings a run, blocks of up to %u (seed %u)\n", n, LOGC_MAX_SAMPLES, seed);
+    printf("flash bytes per reading against a %u-byte entry each, and %u raw bytes;\n"
+           "time per reading on this host (cycles: %s)\n\n",
+           PLAIN_ENTRY, RAW_READING, CYCLES_NAME);
+    printf("%-18s %6s %8s %8s %8s %7s %6s %6s %6s %6s\n", "signal", "blocks",
+           "codec", "flash", "vs 16B", "vs 6B", "enc ns", "dec ns", "enc cy", "dec cy");
+
+    for (Signal s = SIG_STEADY; s <= SIG_RANDOM; s++) {
+        run(s, n);
+    }
+    fuzz(100000);
+
+    printf(failures ? "FAILED\n" : "OK\n");
+    return failures ? 1 : 0;
+}
@@ -0,0 +1,223 @@
+/*
+ * filter_bench.c
+ *
+ *  Created on: Oct 17, 2026
+ *      Author: kings
+ *
+ *  Times the sample-path filters (filter.c) per input sample: each stage
+ *  alone through FLT_ChainProcess, then the chain main.c configures. The
+ *  input is what acq.c hands over, 16-bit samples as Q31 in blocks of one
+ *  ACQ_BLOCK_MS at 1 kHz, with drift, noise and a spike now and then.
+ *  Before timing, each configuration must
+ *
+ *    - put out one sample per input, or n >> log2r less the CIC start-up
+ *      with the CIC on;
+ *    - pass a constant input through to within one 16-bit step.
+ *
+ *  Level is the mean of the last output of each block, 16-bit, so the
+ *  work cannot be optimised away. Host cycles are not Cortex-M4 cycles;
+ *  on the device the chain reports its own (FLT_Stats.cyc_x100, in the
+ *  UART log).
+ *
+ *      filter_bench [samples [seed]]
+ *
+ *  Exits non-zero on the first failed check.
+ */
+
+#include "filter.h"
+#include "main.h"
+
+#include <math.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+#if defined(__x86_64__) || defined(__i386__)
+#include <x86intrin.h>
+#define CYCLES_NAME "TSC"
+#else
+#define CYCLES_NAME "n/a"
+#endif
+
+#define BLOCK_LEN       500U    // ACQ_BLOCK_MS at the balanced profile rate
+
+SIM_DWT_Type SIM_DWT;
+
+static uint32_t failures;
+
+#define CHECK(cond, ...) do {                                   \
+        if (!(cond)) {                                          \
+            printf("FAIL %s:%d: ", __FILE__, __LINE__);         \
+            printf(__VA_ARGS__);                                \
+            printf("\n");                                       \
+            failures++;                                         \
+            return;                                             \
+        }                                                       \
+    } while (0)
+
+/* ======== Configurations ======== */
+
+// As main.c: 0.5 Hz Butterworth low-pass at 62.5 Hz, post shift 1
+static const q31_t glucose_lp[10] = {
+    654827, 1309653, 654827, 2071185984, -1000063466,
+    654827, 1309653, 654827, 2071185984, -1000063466,
+};
+
+typedef struct {
+    const char *name;
+    FLT_Config  cfg;
+} BenchConfig;
+
+static const BenchConfig configs[] = {
+    { "median 3",          { .median_len = 3 } },
+    { "median 5",          { .median_len = 5 } },
+    { "median 7",          { .median_len = 7 } },
+    { "cic 1, R 16",       { .median_len = 1, .cic_order = 1, .cic_log2r = 4 } },
+    { "cic 2, R 16",       { .median_len = 1, .cic_order = 2, .cic_log2r = 4 } },
+    { "cic 3, R 16",       { .median_len = 1, .cic_order = 3, .cic_log2r = 4 } },
+    { "biquad 1 stage",    { .median_len = 1, .biquad_stages = 1,
+                             .biquad_shift = 1, .biquad_coefs = glucose_lp } },
+    { "biquad 2 stages",   { .median_len = 1, .biquad_stages = 2,
+                             .biquad_shift = 1, .biquad_coefs = glucose_lp } },
+    { "chain (main.c)",    { .median_len = 5, .cic_order = 2, .cic_log2r = 4,
+                             .biquad_stages = 1, .biquad_shift = 1,
+                             .biquad_coefs = glucose_lp } },
+};
+
+/* ======== Input ======== */
+
+static q31_t *input;
+static uint32_t n_input;
+
+static uint32_t rng = 1;
+
+static uint32_t rnd(void)
+{
+    rng ^= rng << 13;
+    rng ^= rng >> 17;
+    rng ^= rng << 5;
+    return rng;
+}
+
+static double gauss(void)
+{
+    double u = (rnd() + 1.0) / 4294967297.0;
+    double v = (rnd() + 1.0) / 4294967297.0;
+    return sqrt(-2.0 * log(u)) * cos(6.283185307179586 * v);
+}
+
+static void make_input(uint32_t n)
+{
+    for (uint32_t i = 0; i < n; i++) {
+        // Slow drift around mid-scale, ADC noise, a spike one in 2000
+        double v = 32768.0 + 6000.0 * sin(i * 6.283185307179586 / 600000.0) +
+                   40.0 * gauss();
+        if (rnd() % 2000U == 0U) v += (rnd() & 1U) ? 20000.0 : -20000.0;
+        if (v < 0) v = 0;
+        if (v > 65535) v = 65535;
+        input[i] = (q31_t)v << 15;
+    }
+    n_input = n;
+}
+
+/* ======== Checks ======== */
+
+static uint32_t expected_out(const FLT_Config *cfg, uint32_t n)
+{
+    if (cfg->cic_order == 0U) return n;
+
+    uint32_t m = n >> cfg->cic_log2r;
+    return (m > cfg->cic_order - 1U) ? m - (cfg->cic_order - 1U) : 0U;
+}
+
+static void check_dc(const BenchConfig *b)
+{
+    static FLT_Chain chain;
+    q31_t buf[BLOCK_LEN];
+    const q31_t x = (q31_t)40000 << 15;
+    uint32_t out = 0;
+
+    FLT_ChainInit(&chain, &b->cfg);
+    for (uint32_t blk = 0; blk < 40U; blk++) {
+        for (uint32_t i = 0; i < BLOCK_LEN; i++) buf[i] = x;
+        uint32_t m = FLT_ChainProcess(&chain, buf, buf, BLOCK_LEN);
+        for (uint32_t i = 0; i < m; i++) {
+            CHECK(abs((buf[i] >> 15) - (x >> 15)) <= 1, "%s: constant %d "
+                  "came out as %d", b->name, x >> 15, buf[i] >> 15);
+        }
+        out += m;
+    }
+    CHECK(out == expected_out(&b->cfg, 40U * BLOCK_LEN), "%s: %u samples out "
+          "of %u, expected %u", b->name, out, 40U * BLOCK_LEN,
+          expected_out(&b->cfg, 40U * BLOCK_LEN));
+}
+
+/* ======== Runs ======== */
+
+static uint64_t now_ns(void)
+{
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (uint64_t)ts.tv_sec * 1000000000U + ts.tv_nsec;
+}
+
+static uint64_t cycles(void)
+{
+#if defined(__x86_64__) || defined(__i386__)
+    return __rdtsc();
+#else
+    return 0;
+#endif
+}
+
+static void run(const BenchConfig *b)
+{
+    static FLT_Chain chain;
+    q31_t buf[BLOCK_LEN];
+    uint32_t out = 0, blocks = n_input / BLOCK_LEN;
+    int64_t sum = 0;
+
+    check_dc(b);
+    if (failures) return;
+
+    FLT_ChainInit(&chain, &b->cfg);
+    uint64_t t0 = now_ns(), c0 = cycles();
+    for (uint32_t blk = 0; blk < blocks; blk++) {
+        const q31_t *src = &input[blk * BLOCK_LEN];
+        for (uint32_t i = 0; i < BLOCK_LEN; i++) buf[i] = src[i];
+        uint32_t m = FLT_ChainProcess(&chain, buf, buf, BLOCK_LEN);
+        if (m > 0U) sum += buf[m - 1];      // keep the work observable
+        out += m;
+    }
+    uint64_t ns = now_ns() - t0, cyc = cycles() - c0;
+    uint32_t n = blocks * BLOCK_LEN;
+
+    CHECK(out == expected_out(&b->cfg, n), "%s: %u samples out of %u, "
+          "expected %u", b->name, out, n, expected_out(&b->cfg, n));
+
+    printf("%-18s %9u %8.2f %8.2f %10lld\n", b->name, out, (double)ns / n,
+           (double)cyc / n, (long long)(sum / (blocks ? blocks : 1U)) >> 15);
+}
+
+int main(int argc, char **argv)
+{
+    uint32_t n    = (argc > 1) ? (uint32_t)strtoul(argv[1], NULL, 0) : 2000000U;
+    uint32_t seed = (argc > 2) ? (uint32_t)strtoul(argv[2], NULL, 0) : 1U;
+
+    rng = seed ? seed : 1U;
+    if (n < BLOCK_LEN) n = BLOCK_LEN;
+    input = malloc(n * sizeof(*input));
+    if (!input) return 2;
+    make_input(n);
+
+    printf("%u samples a run in blocks of %u (seed %u)\n", n, BLOCK_LEN, seed);
+    printf("time per input sample on this host (cycles: %s)\n\n", CYCLES_NAME);
+    printf("%-18s %9s %8s %8s %10s\n", "filter", "out", "ns", "cycles", "level");
+
+    for (uint32_t i = 0; i < sizeof(configs) / sizeof(configs[0]); i++) {
+        run(&configs[i]);
+        if (failures) break;
+    }
+
+    printf(failures ? "FAILED\n" : "OK\n");
+    return failures ? 1 : 0;
+}
@@ -0,0 +1,247 @@
+/*
+ * flash_sim.c
+ *
+ *  Created on: Oct 17, 2026
+ *      Author: kings
+ */
+
+#include "flash_sim.h"
+#include "flash_log.h"
+#include "stm32l4xx_hal.h"
+
+#include <string.h>
+
+uint8_t SIM_FlashMem[SIM_FLASH_LEN];
+
+typedef enum {
+    SIM_IDLE,
+    SIM_PROGRAM,
+    SIM_ERASE,
+} SIM_OpKind;
+
+static SIM_OpKind op;
+static uint32_t   op_off;       // byte offset in the bank (page start for erase)
+static uint64_t   op_data;
+static uint8_t    unlocked;
+static uint8_t    hal_lock;     // pFlash.Lock, held through the callbacks
+static uint8_t    irq_masked;
+static uint32_t   wear[SIM_FLASH_PAGES];
+static SIM_FlashStats stats;
+static uint32_t   rng = 1;
+
+void SIM_Seed(uint32_t seed)
+{
+    rng = seed ? seed : 1;
+}
+
+/* xorshift32 */
+uint32_t SIM_Rand(void)
+{
+    rng ^= rng << 13;
+    rng ^= rng >> 17;
+    rng ^= rng << 5;
+    return rng;
+}
+
+static uint64_t rand64(void)
+{
+    return ((uint64_t)SIM_Rand() << 32) | SIM_Rand();
+}
+
+static uint64_t rd64(uint32_t off)
+{
+    uint64_t v;
+    memcpy(&v, &SIM_FlashMem[off], sizeof(v));
+    return v;
+}
+
+static void wr64(uint32_t off, uint64_t v)
+{
+    memcpy(&SIM_FlashMem[off], &v, sizeof(v));
+}
+
+void SIM_FlashFill(int fill)
+{
+    if (fill < 0) {
+        for (uint32_t i = 0; i < SIM_FLASH_LEN; i += 8) wr64(i, rand64());
+    } else {
+        memset(SIM_FlashMem, fill, sizeof(SIM_FlashMem));
+    }
+    memset(wear, 0, sizeof(wear));
+    memset(&stats, 0, sizeof(stats));
+    op = SIM_IDLE;
+    unlocked = 0;
+    hal_lock = 0;
+    irq_masked = 0;
+}
+
+/* ======== HAL ======== */
+
+void __disable_irq(void)
+{
+    irq_masked = 1;
+}
+
+void __enable_irq(void)
+{
+    irq_masked = 0;
+}
+
+void HAL_NVIC_SetPriority(IRQn_Type IRQn, uint32_t PreemptPriority, uint32_t SubPriority)
+{
+    (void)IRQn;
+    (void)PreemptPriority;
+    (void)SubPriority;
+}
+
+void HAL_NVIC_EnableIRQ(IRQn_Type IRQn)
+{
+    (void)IRQn;
+}
+
+HAL_StatusTypeDef HAL_FLASH_Unlock(void)
+{
+    unlocked = 1;
+    return HAL_OK;
+}
+
+static HAL_StatusTypeDef start(SIM_OpKind kind, uint32_t off, uint64_t data)
+{
+    if (hal_lock || (op != SIM_IDLE)) {
+        stats.errors++;
+        return HAL_BUSY;
+    }
+    if (!unlocked) {
+        stats.errors++;
+        return HAL_ERROR;
+    }
+    op      = kind;
+    op_off  = off;
+    op_data = data;
+    return HAL_OK;
+}
+
+HAL_StatusTypeDef HAL_FLASH_Program_IT(uint32_t TypeProgram, uint32_t Address, uint64_t Data)
+{
+    uint32_t off = Address - SIM_FLASH_BASE;
+
+    if ((TypeProgram != FLASH_TYPEPROGRAM_DOUBLEWORD) || (Address < SIM_FLASH_BASE) ||
+        (off >= SIM_FLASH_LEN) || (off & 7U)) {
+        stats.errors++;
+        return HAL_ERROR;
+    }
+    return start(SIM_PROGRAM, off, Data);
+}
+
+HAL_StatusTypeDef HAL_FLASHEx_Erase_IT(FLASH_EraseInitTypeDef *pEraseInit)
+{
+    if ((pEraseInit->TypeErase != FLASH_TYPEERASE_PAGES) ||
+        (pEraseInit->Banks != FLASH_BANK_2) || (pEraseInit->NbPages != 1U) ||
+        (pEraseInit->Page >= SIM_FLASH_PAGES)) {
+        stats.errors++;
+        return HAL_ERROR;
+    }
+    return start(SIM_ERASE, pEraseInit->Page * SIM_FLASH_PAGE_LEN, 0);
+}
+
+/* ======== Operations ======== */
+
+int SIM_FlashStep(void)
+{
+    if (op == SIM_IDLE) return 0;
+    if (irq_masked) {
+        stats.errors++;         // the IRQ could not have run here
+        return 0;
+    }
+
+    SIM_OpKind kind = op;
+    uint8_t ok = 1;
+
+    if (kind == SIM_PROGRAM) {
+        // PROGERR: the double word must still be erased
+        if (rd64(op_off) != ~0ULL) {
+            stats.errors++;
+            ok = 0;
+        } else {
+            wr64(op_off, op_data);
+            stats.programs++;
+        }
+    } else {
+        memset(&SIM_FlashMem[op_off], 0xFF, SIM_FLASH_PAGE_LEN);
+        wear[op_off / SIM_FLASH_PAGE_LEN]++;
+        stats.erases++;
+    }
+
+    // HAL_FLASH_IRQHandler: callbacks with the lock held, then unlock
+    hal_lock = 1;
+    op = SIM_IDLE;
+    if (ok) {
+        HAL_FLASH_EndOfOperationCallback((kind == SIM_ERASE) ? 0xFFFFFFFFU
+                                                            : SIM_FLASH_BASE + op_off);
+    } else {
+        HAL_FLASH_OperationErrorCallback(SIM_FLASH_BASE + op_off);
+    }
+    hal_lock = 0;
+
+    // USER CODE FLASH_IRQn 1
+    FLOG_IRQHandler();
+    return 1;
+}
+
+void SIM_FlashPowerCut(void)
+{
+    stats.cuts++;
+
+    if (op == SIM_PROGRAM) {
+        uint64_t old = rd64(op_off);
+
+        switch (SIM_Rand() % 4U) {
+        case 0:                 // never started
+            break;
+        case 1:                 // some bits still to clear
+            wr64(op_off, old & (op_data | rand64()));
+            break;
+        case 2:                 // ECC double error: the read is garbage
+            wr64(op_off, rand64());
+            break;
+        default:                // done, but the IRQ never ran
+            wr64(op_off, old & op_data);
+            break;
+        }
+        stats.torn++;
+    } else if (op == SIM_ERASE) {
+        uint32_t mode = SIM_Rand() % 3U;
+
+        for (uint32_t i = 0; i < SIM_FLASH_PAGE_LEN; i += 8) {
+            uint32_t off = op_off + i;
+            uint32_t r = SIM_Rand() % 4U;
+
+            if (mode == 2U) {
+                wr64(off, ~0ULL);           // done, but the IRQ never ran
+            } else if (mode == 1U) {
+                if (r == 0U) {
+                    wr64(off, ~0ULL);
+                } else if (r == 1U) {
+                    wr64(off, rand64());
+                }
+            }
+        }
+        if (mode != 0U) wear[op_off / SIM_FLASH_PAGE_LEN]++;
+        stats.torn++;
+    }
+
+    op = SIM_IDLE;
+    unlocked = 0;
+    hal_lock = 0;
+    irq_masked = 0;
+}
+
+uint32_t SIM_FlashWear(uint32_t page)
+{
+    return wear[page];
+}
+
+void SIM_FlashGetStats(SIM_FlashStats *s)
+{
+    *s = stats;
+}
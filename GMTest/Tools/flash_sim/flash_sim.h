@@ -0,0 +1,58 @@
+/*
+ * flash_sim.h
+ *
+ *  Created on: Oct 17, 2026
+ *      Author: kings
+ *
+ *  Simulated flash bank 2 behind the fake HAL flash calls. One operation
+ *  runs at a time as on the chip; it completes when the test says so, and
+ *  a power cut tears whatever is in progress.
+ */
+
+#ifndef FLASH_SIM_H_
+#define FLASH_SIM_H_
+
+#include <stdint.h>
+#include "flash_log.h"
+
+#define SIM_FLASH_BASE      FLOG_ADDR
+#define SIM_FLASH_PAGES     FLOG_PAGES      // bank 2, or more for a bigger model
+#define SIM_FLASH_PAGE_LEN  2048U
+#define SIM_FLASH_LEN       (SIM_FLASH_PAGES * SIM_FLASH_PAGE_LEN)
+
+/* Bank 2 as the CPU reads it; flash_log.c reads through this (FLOG_MEM) */
+extern uint8_t SIM_FlashMem[SIM_FLASH_LEN];
+
+typedef struct {
+    uint32_t programs;      // double words programmed
+    uint32_t erases;        // pages erased
+    uint32_t cuts;          // power cuts
+    uint32_t torn;          // operations torn by a cut
+    uint32_t errors;        // misuse: programming a written double word,
+                            // bad address, busy or locked flash, ...
+} SIM_FlashStats;
+
+/* Every byte set to fill, or random when fill is negative; also a reset */
+void SIM_FlashFill(int fill);
+
+/* Finishes the operation in progress as the flash IRQ would: the HAL
+ * callback, then FLASH_IRQHandler's FLOG_IRQHandler. Returns 0 if there
+ * was none.
+ */
+int  SIM_FlashStep(void);
+
+/* Power loss: the operation in progress is left half done, the queue the
+ * log holds in RAM is gone. Call FLOG_Init to boot again.
+ */
+void SIM_FlashPowerCut(void);
+
+/* Page erases per page, since the last SIM_FlashFill */
+uint32_t SIM_FlashWear(uint32_t page);
+
+void SIM_FlashGetStats(SIM_FlashStats *stats);
+
+/* Seeded PRNG shared with the test so a run can be replayed */
+void     SIM_Seed(uint32_t seed);
+uint32_t SIM_Rand(void);
+
+#endif /* FLASH_SIM_H_ */
@@ -0,0 +1,350 @@
+/*
+ * flash_sim_main.c
+ *
+ *  Created on: Oct 17, 2026
+ *      Author: kings
+ *
+ *  Runs the flash log against the simulated bank 2 with power cuts at
+ *  random points, checking after every reboot that
+ *
+ *    - every entry committed before the cut is still there, in order, back
+ *      to the oldest page the ring kept;
+ *    - nothing comes back that was not appended, or comes back damaged;
+ *    - the flash was never misused (programming over data, overlapping
+ *      operations) and wear stays even.
+ *
+ *      flash_sim [cycles [seed]]
+ *
+ *  Exits non-zero on the first failed check.
+ */
+
+#include "flash_sim.h"
+#include "flash_log.h"
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#define MAX_ENTRIES     (1U << 23)
+#define MIN_LEN         4U          // room for the id
+
+typedef enum {
+    ENT_PENDING,                    // queued, its header not known to be in
+    ENT_DURABLE,                    // header programmed before the cut
+    ENT_LOST,                       // cut before the header went in
+} EntryState;
+
+typedef struct {
+    uint16_t len;
+    uint8_t  type;
+    uint8_t  state;
+} Entry;
+
+static Entry    entries[MAX_ENTRIES];
+static uint32_t n_entries;
+static uint32_t boot_first;         // first id appended since the last boot
+static uint32_t failures;
+
+#define CHECK(cond, ...) do {                                   \
+        if (!(cond)) {                                          \
+            printf("FAIL %s:%d: ", __FILE__, __LINE__);         \
+            printf(__VA_ARGS__);                                \
+            printf("\n");                                       \
+            failures++;                                         \
+            return;                                             \
+        }                                                       \
+    } while (0)
+
+/* ======== Entries ======== */
+
+/* Payload: the id, then bytes that follow from it */
+static void make_payload(uint32_t id, uint16_t len, uint8_t *buf)
+{
+    uint32_t x = id * 2654435761U + 1U;
+
+    memcpy(buf, &id, sizeof(id));
+    for (uint16_t i = 4; i < len; i++) {
+        x = x * 1103515245U + 12345U;
+        buf[i] = x >> 24;
+    }
+}
+
+static uint8_t append(uint16_t len)
+{
+    uint8_t buf[FLOG_MAX_ENTRY];
+    uint32_t id = n_entries;
+    uint8_t type = 1U + id % 0xFDU;
+
+    if (id >= MAX_ENTRIES) return 0;
+    make_payload(id, len, buf);
+    if (!FLOG_Append(type, buf, len)) return 0;
+
+    entries[id] = (Entry){ .len = len, .type = type, .state = ENT_PENDING };
+    n_entries++;
+    return 1;
+}
+
+static uint16_t random_len(void)
+{
+    // Mostly short records like the firmware's, now and then a long one
+    uint32_t r = SIM_Rand();
+    if ((r & 15U) == 0U) return MIN_LEN + (r >> 8) % (FLOG_MAX_ENTRY - MIN_LEN + 1U);
+    return MIN_LEN + (r >> 8) % 20U;
+}
+
+/* Whatever the log returns must be an entry appended with that content */
+static int entry_ok(const FLOG_Entry *e, uint32_t *id)
+{
+    uint8_t buf[FLOG_MAX_ENTRY];
+
+    if (e->len < MIN_LEN) return 0;
+    memcpy(id, e->data, sizeof(*id));
+    if (*id >= n_entries) return 0;
+
+    const Entry *x = &entries[*id];
+    if ((x->len != e->len) || (x->type != e->type)) return 0;
+    make_payload(*id, e->len, buf);
+    return memcmp(buf, e->data, e->len) == 0;
+}
+
+/* ======== Checks ======== */
+
+/* After a boot: entries come back in order; committed ones are all there
+ * from the oldest one kept; a pending one is either there (its header made
+ * it) or gone for good.
+ */
+static void check_log(uint32_t *kept)
+{
+    FLOG_Iter it;
+    FLOG_Entry e;
+    uint32_t id, prev = 0, count = 0, first = 0;
+    uint8_t  any = 0;
+
+    FLOG_IterInit(&it);
+    while (FLOG_Next(&it, &e)) {
+        CHECK(entry_ok(&e, &id), "bad entry (type %u, len %u)", e.type, e.len);
+        CHECK(!any || (id > prev), "entry %u after %u", id, prev);
+        CHECK(entries[id].state != ENT_LOST, "entry %u was lost, came back", id);
+
+        if (!any) first = id;
+        // Everything durable between the last entry and this one is missing
+        for (uint32_t k = any ? prev + 1U : id; k < id; k++) {
+            CHECK(entries[k].state != ENT_DURABLE, "entry %u missing", k);
+            entries[k].state = ENT_LOST;
+        }
+        entries[id].state = ENT_DURABLE;
+        prev = id;
+        any = 1;
+        count++;
+    }
+
+    // The newest durable entries are all there
+    for (uint32_t k = any ? prev + 1U : 0U; k < n_entries; k++) {
+        CHECK(entries[k].state != ENT_DURABLE, "entry %u missing at the end", k);
+        entries[k].state = ENT_LOST;
+    }
+    // Pending ones before the first kept went with their page
+    for (uint32_t k = boot_first; k < first; k++) {
+        if (entries[k].state == ENT_PENDING) entries[k].state = ENT_LOST;
+    }
+
+    *kept = count;
+}
+
+/* The export covers the pages from the oldest to the head, byte for byte */
+static void check_export(void)
+{
+    static uint8_t buf[SIM_FLASH_LEN + 8];
+    FLOG_Stats s;
+
+    FLOG_GetStats(&s);
+    uint32_t size = FLOG_Size();
+    CHECK(size == s.pages * SIM_FLASH_PAGE_LEN, "size %u for %u pages", size, s.pages);
+    CHECK(FLOG_Read(0, buf, sizeof(buf)) == size, "short export");
+    CHECK(FLOG_Read(size, buf, 8) == 0, "read past the end");
+
+    // Page sequence numbers run on from the first
+    uint32_t seq0;
+    memcpy(&seq0, buf, 4);
+    for (uint32_t p = 0; p < s.pages; p++) {
+        uint32_t seq, inv;
+        memcpy(&seq, &buf[p * SIM_FLASH_PAGE_LEN], 4);
+        memcpy(&inv, &buf[p * SIM_FLASH_PAGE_LEN + 4], 4);
+        if (p + 1U == s.pages && inv != ~seq) break;   // head header still queued
+        CHECK((seq == seq0 + p) && (inv == ~seq), "export page %u: seq %u", p, seq);
+    }
+}
+
+static void drain(void)
+{
+    while (SIM_FlashStep()) {
+    }
+}
+
+static void boot(uint32_t *kept)
+{
+    FLOG_Init();
+    boot_first = n_entries;
+    check_log(kept);
+}
+
+/* Durable: the first `committed` entries queued since boot, FIFO */
+static void mark_committed(void)
+{
+    FLOG_Stats s;
+
+    FLOG_GetStats(&s);
+    for (uint32_t k = boot_first; k < boot_first + s.committed; k++) {
+        entries[k].state = ENT_DURABLE;
+    }
+}
+
+/* ======== Scenarios ======== */
+
+static void test_basic(void)
+{
+    FLOG_Iter it;
+    FLOG_Entry e;
+    uint32_t kept, id, seen = 0;
+
+    SIM_FlashFill(0xFF);
+    n_entries = 0;
+    boot(&kept);
+    CHECK(kept == 0, "fresh log has %u entries", kept);
+
+    // A live iterator picks up entries as they are committed
+    FLOG_IterInit(&it);
+    for (uint32_t i = 0; i < 2000; i++) {
+        CHECK(append(random_len()), "append %u dropped", i);
+        drain();
+        while (FLOG_Next(&it, &e)) {
+            CHECK(entry_ok(&e, &id) && (id == seen), "live entry %u", seen);
+            seen++;
+        }
+    }
+    CHECK(seen == 2000, "live iterator saw %u", seen);
+    mark_committed();
+
+    boot(&kept);
+    CHECK(kept == 2000, "%u of 2000 entries after reboot", kept);
+    check_export();
+
+    // Refused: empty, too long, reserved types
+    uint8_t buf[FLOG_MAX_ENTRY + 1] = {0};
+    CHECK(!FLOG_Append(0x01, buf, 0), "empty entry taken");
+    CHECK(!FLOG_Append(0x01, buf, FLOG_MAX_ENTRY + 1U), "long entry taken");
+    CHECK(!FLOG_Append(0x00, buf, 8), "type 0x00 taken");
+    CHECK(!FLOG_Append(0xFF, buf, 8), "type 0xFF taken");
+
+    printf("basic: 2000 entries, live and after reboot\n");
+}
+
+/* Three laps without power cuts: the ring keeps all but the spare pages,
+ * and every page is erased the same number of times.
+ */
+static void test_wrap(void)
+{
+    FLOG_Stats s;
+    uint32_t kept, lo = ~0U, hi = 0;
+
+    SIM_FlashFill(-1);              // garbage, as from some other use
+    n_entries = 0;
+    boot(&kept);
+
+    while (1) {
+        FLOG_GetStats(&s);
+        if (s.erases >= 3U * FLOG_PAGES) break;
+        if (!append(random_len())) {
+            CHECK(SIM_FlashStep(), "append dropped with the flash idle");
+        }
+        if (SIM_Rand() & 1U) SIM_FlashStep();
+    }
+    drain();
+    mark_committed();
+    boot(&kept);
+    check_export();
+
+    FLOG_GetStats(&s);
+    CHECK(s.pages >= FLOG_PAGES - FLOG_SPARE_PAGES, "%u pages kept", s.pages);
+    for (uint32_t p = 0; p < FLOG_PAGES; p++) {
+        uint32_t w = SIM_FlashWear(p);
+        if (w < lo) lo = w;
+        if (w > hi) hi = w;
+    }
+    CHECK(hi - lo <= 1U, "wear %u..%u erases per page", lo, hi);
+
+    printf("wrap: %u entries appended, %u kept in %u pages, wear %u..%u\n",
+           n_entries, kept, s.pages, lo, hi);
+}
+
+/* Random appends and flash steps, cut at a random point, reboot, check */
+static void test_power_loss(uint32_t cycles)
+{
+    FLOG_Stats s;
+    SIM_FlashStats fs;
+    uint32_t kept = 0, recovered = 0, dropped = 0, lo = ~0U, hi = 0;
+    uint64_t kept_sum = 0;
+
+    SIM_FlashFill(-1);
+    n_entries = 0;
+    boot(&kept);
+
+    for (uint32_t c = 0; c < cycles && !failures; c++) {
+        // Mostly short runs, now and then long enough to go round the ring
+        uint32_t r = SIM_Rand();
+        uint32_t actions = ((r & 31U) == 0U) ? 20000U + r % 40000U : r % 600U;
+        uint32_t step_odds = 1U + (r >> 16) % 4U;   // steps per append, about
+
+        for (uint32_t a = 0; a < actions; a++) {
+            if (SIM_Rand() % (step_odds + 1U) == 0U) {
+                append(random_len());
+            } else {
+                SIM_FlashStep();
+            }
+        }
+        mark_committed();
+        FLOG_GetStats(&s);
+        dropped += s.dropped;
+
+        SIM_FlashPowerCut();
+        boot(&kept);
+        if (failures) break;
+
+        FLOG_GetStats(&s);
+        recovered += s.recovered;
+        kept_sum += kept;
+        if ((c & 63U) == 0U) check_export();
+    }
+
+    SIM_FlashGetStats(&fs);
+    for (uint32_t p = 0; p < FLOG_PAGES; p++) {
+        uint32_t w = SIM_FlashWear(p);
+        if (w < lo) lo = w;
+        if (w > hi) hi = w;
+    }
+    CHECK(fs.errors == 0, "%u flash misuses", fs.errors);
+
+    printf("power loss: %u cuts (%u mid-operation), %u torn pages closed\n",
+           fs.cuts, fs.torn, recovered);
+    printf("  %u entries appended, %u dropped on a full queue, %u kept on average\n",
+           n_entries, dropped, cycles ? (uint32_t)(kept_sum / cycles) : 0U);
+    printf("  %u programs, %u erases, wear %u..%u erases per page\n",
+           fs.programs, fs.erases, lo, hi);
+}
+
+int main(int argc, char **argv)
+{
+    uint32_t cycles = (argc > 1) ? (uint32_t)strtoul(argv[1], NULL, 0) : 2000U;
+    uint32_t seed   = (argc > 2) ? (uint32_t)strtoul(argv[2], NULL, 0) : 1U;
+
+    SIM_Seed(seed);
+    printf("flash log: %u pages of %u bytes, %u spare, queue %u (seed %u)\n",
+           FLOG_PAGES, SIM_FLASH_PAGE_LEN, FLOG_SPARE_PAGES, FLOG_QUEUE_LEN, seed);
+
+    test_basic();
+    if (!failures) test_wrap();
+    if (!failures) test_power_loss(cycles);
+
+    printf(failures ? "FAILED\n" : "OK\n");
+    return failures ? 1 : 0;
+}
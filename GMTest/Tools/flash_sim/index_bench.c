@@ -0,0 +1,302 @@
+/*
+ * index_bench.c
+ *
+ *  Created on: Oct 17, 2026
+ *      Author: kings
+ *
+ *  Fills a simulated log with sessions of readings the way main.c writes
+ *  them (LOGC blocks a minute long, alarm entries, reboots), past one lap
+ *  of the ring, then measures the time index (log_index.c): its rebuild at
+ *  boot and range queries against a walk from the start of the log. Every
+ *  query result is checked against the readings that went in.
+ *
+ *  Built with FLOG_PAGES=512 by the Makefile: a 1 MB log, twice bank 2.
+ *
+ *      index_bench [queries [seed]]
+ */
+
+#include "flash_sim.h"
+#include "flash_log.h"
+#include "log_codec.h"
+#include "log_index.h"
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+#define LOG_SESSION     0x01
+#define LOG_ALARM       0x03
+#define LOG_READINGS    0x04
+
+#define READING_MS      500U
+#define MAX_READINGS    (8U << 20)
+#define WINDOW_MS       (30U * 60U * 1000U)
+
+static LOGC_Sample  *ref;           // every reading logged, in order
+static uint32_t      n_ref;
+static LOGC_Sample  *got;
+static LOGC_Encoder  enc;
+static uint32_t      failures;
+
+static uint64_t now_ns(void)
+{
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (uint64_t)ts.tv_sec * 1000000000U + ts.tv_nsec;
+}
+
+static void drain(void)
+{
+    while (SIM_FlashStep()) {
+    }
+}
+
+/* As main.c's LogReadings */
+static void log_readings(const uint8_t *block, uint16_t len)
+{
+    LOGC_Sample s[LOGC_MAX_SAMPLES];
+    uint8_t m = LOGC_Decode(block, len, s, LOGC_MAX_SAMPLES);
+
+    if (FLOG_Append(LOG_READINGS, block, len)) {
+        LIDX_AddBlock(block, len);
+        memcpy(&ref[n_ref], s, m * sizeof(s[0]));
+        n_ref += m;
+    }
+    drain();
+}
+
+static void boot(void)
+{
+    FLOG_Init();
+    LIDX_Init(LOG_READINGS);
+    drain();
+}
+
+/* One session: power on, readings for a while, an alarm now and then */
+static void session(uint32_t readings)
+{
+    uint32_t tick = 2000;
+    uint16_t value = 30000 + SIM_Rand() % 8000U;
+    uint16_t flags = 0;
+    uint32_t entry[2];
+
+    boot();
+    entry[0] = LIDX_Time(tick);
+    entry[1] = 0x0C000000;
+    FLOG_Append(LOG_SESSION, entry, sizeof(entry));
+    drain();
+    LOGC_Init(&enc, log_readings);
+
+    for (uint32_t i = 0; i < readings && n_ref + LOGC_MAX_SAMPLES < MAX_READINGS; i++) {
+        value += (int16_t)(SIM_Rand() % 9U) - 4;
+        if (SIM_Rand() % 2000U == 0U) {
+            // Alarm change: the open block goes in first
+            LOGC_Flush(&enc);
+            entry[0] = LIDX_Time(tick + 3U);
+            entry[1] = 0x0200;
+            FLOG_Append(LOG_ALARM, entry, sizeof(entry));
+            drain();
+        }
+        if (SIM_Rand() % 5000U == 0U) tick += READING_MS * (1U + SIM_Rand() % 4U);
+        if (SIM_Rand() % 20000U == 0U) flags ^= 0x0004;
+
+        LOGC_Add(&enc, LIDX_Time(tick), value, flags);
+        tick += READING_MS;
+    }
+    LOGC_Flush(&enc);
+}
+
+/* ======== Reference ======== */
+
+static uint8_t before(uint32_t a, uint32_t b)
+{
+    return (int32_t)(a - b) < 0;
+}
+
+/* Oldest reading still in the log, by walking it */
+static uint32_t oldest_kept(void)
+{
+    FLOG_Iter it;
+    FLOG_Entry e;
+    uint32_t first, last;
+
+    FLOG_IterInit(&it);
+    while (FLOG_Next(&it, &e)) {
+        if ((e.type == LOG_READINGS) && LOGC_BlockSpan(e.data, e.len, &first, &last)) {
+            return first;
+        }
+    }
+    return 0;
+}
+
+static uint32_t ref_find(uint32_t time)
+{
+    uint32_t lo = 0, hi = n_ref;
+    while (lo < hi) {
+        uint32_t mid = (lo + hi) / 2U;
+        if (before(ref[mid].tick, time)) lo = mid + 1U; else hi = mid;
+    }
+    return lo;
+}
+
+/* Without the index: decode from the oldest entry on */
+static uint32_t scan_read(uint32_t from, uint32_t to, LOGC_Sample *out, uint32_t max,
+                          uint32_t *walked)
+{
+    static LOGC_Sample s[LOGC_MAX_SAMPLES];
+    FLOG_Iter it;
+    FLOG_Entry e;
+    uint32_t count = 0, first, last;
+
+    *walked = 0;
+    FLOG_IterInit(&it);
+    while ((count < max) && FLOG_Next(&it, &e)) {
+        (*walked)++;
+        if ((e.type != LOG_READINGS) || !LOGC_BlockSpan(e.data, e.len, &first, &last)) continue;
+        if (before(to, first)) break;
+        if (before(last, from)) continue;
+        uint8_t m = LOGC_Decode(e.data, e.len, s, LOGC_MAX_SAMPLES);
+        for (uint8_t i = 0; (i < m) && (count < max); i++) {
+            if (!before(s[i].tick, from) && !before(to, s[i].tick)) out[count++] = s[i];
+        }
+    }
+    return count;
+}
+
+/* Entries the index leaves to walk before the first wanted reading */
+static uint32_t index_walk(uint32_t from)
+{
+    FLOG_Iter it;
+    FLOG_Entry e;
+    uint32_t walked = 0, first, last;
+
+    LIDX_Seek(&it, from);
+    while (FLOG_Next(&it, &e)) {
+        walked++;
+        if ((e.type == LOG_READINGS) && LOGC_BlockSpan(e.data, e.len, &first, &last) &&
+            !before(last, from)) {
+            break;
+        }
+    }
+    return walked;
+}
+
+static void check(const char *what, uint32_t from, uint32_t to, uint32_t n, uint32_t kept)
+{
+    uint32_t lo = ref_find(before(from, kept) ? kept : from);
+    uint32_t hi = ref_find(to + 1U);
+
+    if ((n != hi - lo) || memcmp(got, &ref[lo], n * sizeof(got[0]))) {
+        printf("FAIL %s %u..%u: %u readings, expected %u\n", what, from, to, n, hi - lo);
+        failures++;
+    }
+}
+
+/* ======== Runs ======== */
+
+int main(int argc, char **argv)
+{
+    uint32_t queries = (argc > 1) ? (uint32_t)strtoul(argv[1], NULL, 0) : 2000U;
+    uint32_t seed    = (argc > 2) ? (uint32_t)strtoul(argv[2], NULL, 0) : 1U;
+    uint32_t max_got = WINDOW_MS / READING_MS * 2U;
+    LIDX_Stats ls;
+    FLOG_Stats fs;
+
+    SIM_Seed(seed);
+    ref = malloc(MAX_READINGS * sizeof(*ref));
+    got = malloc(max_got * sizeof(*got));
+    if (!ref || !got) return 2;
+
+    // Sessions of 1 to 12 hours until the ring has gone round once
+    SIM_FlashFill(0xFF);
+    uint32_t sessions = 0, bound = 0, erases = 0;
+    do {
+        session((1U + SIM_Rand() % 12U) * 7200U);
+        sessions++;
+        LIDX_GetStats(&ls);
+        if (ls.entries > bound) bound = ls.entries;
+        FLOG_GetStats(&fs);             // counts from the session's boot
+        erases += fs.erases;
+    } while ((erases < FLOG_PAGES + FLOG_PAGES / 4U) || (sessions < 3U));
+
+    // Reboot: the index comes back from the entry headers
+    uint64_t t0 = now_ns();
+    boot();
+    uint64_t rebuild_ns = now_ns() - t0;
+    LIDX_GetStats(&ls);
+    FLOG_GetStats(&fs);
+
+    uint32_t kept  = oldest_kept();
+    uint32_t newest = ref[n_ref - 1U].tick;
+    uint32_t span  = newest - kept;
+
+    printf("log: %u KB in %u pages, %u sessions, %.1f h of readings kept (%u logged)\n",
+           FLOG_PAGES * 2U, fs.pages, sessions, span / 3600000.0, n_ref);
+    printf("index: %u entries (never more than %u), %u blocks each, %u blocks\n",
+           ls.entries, bound, ls.stride, ls.blocks);
+    printf("rebuild at boot: %u entries walked, %.2f ms\n\n", ls.walked, rebuild_ns / 1e6);
+    if (bound > LIDX_MAX_ENTRIES) {
+        printf("FAIL index grew to %u entries\n", bound);
+        failures++;
+    }
+
+    // Last 30 minutes, with and without the index
+    uint32_t n, walked;
+    uint32_t from = newest - WINDOW_MS + 1U;
+    t0 = now_ns();
+    n = LIDX_Read(from, newest, got, max_got);
+    uint64_t last_ns = now_ns() - t0;
+    check("last 30 min", from, newest, n, kept);
+    t0 = now_ns();
+    n = scan_read(from, newest, got, max_got, &walked);
+    uint64_t last_scan_ns = now_ns() - t0;
+    check("last 30 min scan", from, newest, n, kept);
+    printf("last 30 min: %u readings, index %.1f us (%u entries walked), "
+           "scan %.1f us (%u)\n\n", n, last_ns / 1e3, index_walk(from),
+           last_scan_ns / 1e3, walked);
+
+    // Random 30 minute windows over what is kept
+    uint64_t seek_ns = 0, read_ns = 0, scan_ns = 0, read_max = 0;
+    uint64_t walk_sum = 0, scan_walk_sum = 0;
+    uint32_t walk_max = 0;
+    for (uint32_t q = 0; q < queries && !failures; q++) {
+        FLOG_Iter it;
+        from = kept + (uint32_t)(((uint64_t)SIM_Rand() * (span - WINDOW_MS)) >> 32);
+        uint32_t to = from + WINDOW_MS - 1U;
+
+        t0 = now_ns();
+        LIDX_Seek(&it, from);
+        seek_ns += now_ns() - t0;
+
+        t0 = now_ns();
+        n = LIDX_Read(from, to, got, max_got);
+        uint64_t dt = now_ns() - t0;
+        read_ns += dt;
+        if (dt > read_max) read_max = dt;
+        check("window", from, to, n, kept);
+
+        uint32_t w = index_walk(from);
+        walk_sum += w;
+        if (w > walk_max) walk_max = w;
+
+        if (q < queries / 10U) {        // the scan is slow; a sample will do
+            t0 = now_ns();
+            n = scan_read(from, to, got, max_got, &walked);
+            scan_ns += now_ns() - t0;
+            scan_walk_sum += walked;
+            check("window scan", from, to, n, kept);
+        }
+    }
+
+    uint32_t scans = queries / 10U ? queries / 10U : 1U;
+    printf("%u random 30 min windows:\n", queries);
+    printf("  index seek     %8.2f us\n", seek_ns / 1e3 / queries);
+    printf("  index read     %8.2f us, worst %.2f us, %.1f entries walked (worst %u)\n",
+           read_ns / 1e3 / queries, read_max / 1e3, (double)walk_sum / queries, walk_max);
+    printf("  scan read      %8.2f us, %.1f entries walked\n",
+           scan_ns / 1e3 / scans, (double)scan_walk_sum / scans);
+
+    printf(failures ? "FAILED\n" : "OK\n");
+    return failures ? 1 : 0;
+}
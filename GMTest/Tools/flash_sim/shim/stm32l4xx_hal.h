@@ -0,0 +1,64 @@
+/*
+ * stm32l4xx_hal.h
+ *
+ *  Created on: Oct 17, 2026
+ *      Author: kings
+ *
+ *  Host stand-in for the HAL header: just the types, constants and calls
+ *  the flash log uses. Flash operations go to the simulated bank 2 in
+ *  flash_sim.c.
+ */
+
+#ifndef SIM_STM32L4XX_HAL_H_
+#define SIM_STM32L4XX_HAL_H_
+
+#include <stdint.h>
+#include <stddef.h>
+
+typedef enum {
+    HAL_OK      = 0x00U,
+    HAL_ERROR   = 0x01U,
+    HAL_BUSY    = 0x02U,
+    HAL_TIMEOUT = 0x03U
+} HAL_StatusTypeDef;
+
+typedef enum {
+    FLASH_IRQn = 4,
+} IRQn_Type;
+
+typedef struct {
+    uint32_t TypeErase;
+    uint32_t Banks;
+    uint32_t Page;
+    uint32_t NbPages;
+} FLASH_EraseInitTypeDef;
+
+#define FLASH_PAGE_SIZE                 0x00000800U
+#define FLASH_BANK_1                    0x00000001U
+#define FLASH_BANK_2                    0x00000002U
+#define FLASH_TYPEERASE_PAGES           0x00000000U
+#define FLASH_TYPEPROGRAM_DOUBLEWORD    0x00000000U
+#define FLASH_FLAG_ALL_ERRORS           0x0000C3FAU
+
+/* Bank 2 as the CPU reads it, in flash_sim.c (the Makefile sets FLOG_MEM) */
+extern uint8_t SIM_FlashMem[];
+
+#define __HAL_FLASH_CLEAR_FLAG(__FLAG__)    ((void)(__FLAG__))
+
+/* PRIMASK: the simulated flash IRQ is held back while interrupts are masked */
+void __disable_irq(void);
+void __enable_irq(void);
+#define __DMB()             __sync_synchronize()
+
+void HAL_NVIC_SetPriority(IRQn_Type IRQn, uint32_t PreemptPriority, uint32_t SubPriority);
+void HAL_NVIC_EnableIRQ(IRQn_Type IRQn);
+
+HAL_StatusTypeDef HAL_FLASH_Unlock(void);
+HAL_StatusTypeDef HAL_FLASH_Program_IT(uint32_t TypeProgram, uint32_t Address, uint64_t Data);
+HAL_StatusTypeDef HAL_FLASHEx_Erase_IT(FLASH_EraseInitTypeDef *pEraseInit);
+
+/* Implemented by the log, called by the simulated flash IRQ */
+void HAL_FLASH_EndOfOperationCallback(uint32_t ReturnValue);
+void HAL_FLASH_OperationErrorCallback(uint32_t ReturnValue);
+
+#endif /* SIM_STM32L4XX_HAL_H_ */
@@ -0,0 +1,150 @@
+#!/usr/bin/env python3
+"""
+flog_read.py - list the entries in a session log exported with
+tlm_decode.py --dump.
+
+The export is the log's flash pages from the oldest to the newest; see
+Core/Inc/flash_log.h for the layout, the LOG_x entry types in main.c and
+Core/Inc/log_codec.h for the reading blocks.
+
+    python3 Tools/flog_read.py session.bin               # one line per entry
+    python3 Tools/flog_read.py session.bin --csv out.csv # readings only
+
+Pages whose header does not check out (erased or torn) are skipped, as is
+the rest of a page after a damaged entry, the same as on the device.
+Times are log times (ms): HAL_GetTick plus a base that carries on across
+resets (Core/Inc/log_index.h), so they only go up from entry to entry.
+"""
+
+import argparse
+import binascii
+import struct
+import sys
+
+PAGE_LEN = 2048
+
+LOG_SESSION = 0x01
+LOG_READING = 0x02                      # one per entry, before log_codec.c
+LOG_ALARM = 0x03
+LOG_READINGS = 0x04
+
+LOGC_VARINT = 0xFF
+
+ALARM_KINDS = ["low", "high", "rapid"]
+ALARM_STATES = ["cleared", "pending", "ACTIVE", "silenced"]
+
+
+def entries(data):
+    """Yield (page seq, offset, type, payload) for every good entry."""
+    for base in range(0, len(data) - PAGE_LEN + 1, PAGE_LEN):
+        seq, inv = struct.unpack_from("<II", data, base)
+        if inv != seq ^ 0xFFFFFFFF:
+            continue
+        off = 8
+        while off + 8 <= PAGE_LEN:
+            length, etype, check, crc = struct.unpack_from("<HBBI", data, base + off)
+            if length == 0xFFFF and etype == 0xFF:
+                break                       # blank: end of the page
+            want = ~((length & 0xFF) ^ (length >> 8) ^ etype) & 0xFF
+            end = off + 8 + ((length + 7) & ~7)
+            if length == 0 or etype in (0, 0xFF) or check != want or end > PAGE_LEN:
+                break                       # torn header: page closed
+            payload = data[base + off + 8:base + off + 8 + length]
+            if binascii.crc32(payload) == crc:
+                yield seq, off, etype, payload
+            off = end
+
+
+def decode_block(block):
+    """Readings (tick, value, flags) in a LOG_READINGS block, [] if bad."""
+    if len(block) < 12:
+        return []
+    tick, value, period, flags, count, width = struct.unpack_from("<IHHHBB", block)
+    body = block[12:]
+    zz = []
+    if width == LOGC_VARINT:
+        z = shift = 0
+        for b in body:
+            z |= (b & 0x7F) << shift
+            shift += 7
+            if not b & 0x80:
+                zz.append(z)
+                z = shift = 0
+        if shift or len(zz) != count - 1:
+            return []
+    elif width <= 16:
+        if len(body) != ((count - 1) * width + 7) // 8:
+            return []
+        bits = int.from_bytes(body, "little")
+        zz = [(bits >> (i * width)) & ((1 << width) - 1) for i in range(count - 1)]
+    else:
+        return []
+
+    out = [(tick, value, flags)]
+    for z in zz:
+        value = (value + ((z >> 1) ^ -(z & 1))) & 0xFFFF
+        tick += period
+        out.append((tick, value, flags))
+    return out
+
+
+def readings(etype, payload):
+    if etype == LOG_READING and len(payload) >= 8:
+        return [struct.unpack_from("<IHH", payload)]
+    if etype == LOG_READINGS:
+        return decode_block(payload)
+    return []
+
+
+def describe(etype, payload):
+    if etype == LOG_SESSION and len(payload) >= 8:
+        return "session  %10u ms  reset flags 0x%08X" % struct.unpack_from("<II", payload)
+    if etype == LOG_SESSION and len(payload) >= 4:
+        return "session  reset flags 0x%08X" % struct.unpack_from("<I", payload)
+    if etype == LOG_READING and len(payload) >= 8:
+        tick, filt16, flags = struct.unpack_from("<IHH", payload)
+        return "reading  %10u ms  signal %5u  flags 0x%04X" % (tick, filt16, flags)
+    if etype == LOG_ALARM and len(payload) >= 6:
+        tick, kind, state = struct.unpack_from("<IBB", payload)
+        name = ALARM_KINDS[kind] if kind < len(ALARM_KINDS) else str(kind)
+        st = ALARM_STATES[state] if state < len(ALARM_STATES) else str(state)
+        return "alarm    %10u ms  %s %s" % (tick, name, st)
+    if etype == LOG_READINGS:
+        rs = decode_block(payload)
+        if rs:
+            return "readings %10u ms  %u, %u bytes, signal %u..%u" % (
+                rs[0][0], len(rs), len(payload),
+                min(r[1] for r in rs), max(r[1] for r in rs))
+    return "type 0x%02X  %s" % (etype, payload.hex())
+
+
+def main():
+    ap = argparse.ArgumentParser(description=__doc__.split("\n\n")[0])
+    ap.add_argument("input", help="exported log file")
+    ap.add_argument("--csv", help="write readings to this CSV file")
+    args = ap.parse_args()
+
+    with open(args.input, "rb") as f:
+        data = f.read()
+
+    csv = open(args.csv, "w") if args.csv else None
+    if csv:
+        csv.write("tick_ms,filt16,flags\n")
+
+    count = 0
+    for seq, off, etype, payload in entries(data):
+        count += 1
+        if csv:
+            for r in readings(etype, payload):
+                csv.write("%u,%u,%u\n" % r)
+        else:
+            print("%6u:%04X  %s" % (seq, off, describe(etype, payload)))
+
+    if csv:
+        csv.close()
+    print("%u entries in %u pages" % (count, len(data) // PAGE_LEN), file=sys.stderr)
+    return 0
+
+
+if __name__ == "__main__":
+    sys.exit(main())
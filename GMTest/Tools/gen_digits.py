@@ -0,0 +1,151 @@
+#!/usr/bin/env python3
+"""
+gen_digits.py - generate the large anti-aliased readout digits.
+
+Digits are described as stroked paths in a unit box and rasterized with
+4x4 supersampling into 4-bit coverage. Each glyph is stored row-major,
+two pixels per byte (left pixel in the high nibble), so a glyph window can
+be streamed to the ILI9341 in scan order without any scaling.
+
+Writes Core/Inc/GFX_Digits.h and Core/Src/GFX_Digits.c. Run it from the
+GMTest directory after changing sizes or shapes:
+
+    python3 Tools/gen_digits.py
+"""
+
+import math
+import os
+
+SIZES = [(24, 32), (32, 48)]    # (width, height) in pixels
+SUPERSAMPLE = 4
+STROKE = 0.15                   # stroke width relative to glyph width
+
+
+def arc(cx, cy, rx, ry, a0, a1, steps=48):
+    """Points along an elliptical arc, angles in degrees, y pointing down."""
+    pts = []
+    for i in range(steps + 1):
+        a = math.radians(a0 + (a1 - a0) * i / steps)
+        pts.append((cx + rx * math.cos(a), cy - ry * math.sin(a)))
+    return pts
+
+
+def flip(paths):
+    return [[(1 - x, 1 - y) for (x, y) in p] for p in paths]
+
+
+SIX = [
+    arc(0.50, 0.67, 0.33, 0.27, 0, 360),
+    arc(0.62, 0.62, 0.45, 0.55, 75, 180) + [(0.17, 0.67)],
+]
+
+DIGITS = {
+    '0': [arc(0.50, 0.50, 0.36, 0.44, 0, 360)],
+    '1': [[(0.28, 0.20), (0.52, 0.06), (0.52, 0.94)],
+          [(0.28, 0.94), (0.76, 0.94)]],
+    '2': [arc(0.50, 0.30, 0.33, 0.24, 160, -25) + [(0.15, 0.94), (0.87, 0.94)]],
+    '3': [arc(0.50, 0.28, 0.31, 0.22, 150, -90),
+          arc(0.50, 0.72, 0.35, 0.22, 90, -150)],
+    '4': [[(0.66, 0.94), (0.66, 0.06), (0.12, 0.68), (0.90, 0.68)]],
+    '5': [[(0.82, 0.06), (0.24, 0.06), (0.20, 0.47)] +
+          arc(0.50, 0.67, 0.35, 0.27, 135, -150)],
+    '6': SIX,
+    '7': [[(0.12, 0.06), (0.88, 0.06), (0.40, 0.94)]],
+    '8': [arc(0.50, 0.27, 0.28, 0.21, 0, 360),
+          arc(0.50, 0.71, 0.34, 0.23, 0, 360)],
+    '9': flip(SIX),
+}
+
+
+def seg_dist(px, py, ax, ay, bx, by):
+    dx, dy = bx - ax, by - ay
+    l2 = dx * dx + dy * dy
+    t = 0.0 if l2 == 0 else max(0.0, min(1.0, ((px - ax) * dx + (py - ay) * dy) / l2))
+    qx, qy = ax + t * dx - px, ay + t * dy - py
+    return math.hypot(qx, qy)
+
+
+def rasterize(paths, w, h):
+    # Inner box keeps a small margin so strokes are not clipped.
+    mx, my = 0.12 * w, 0.06 * h
+    iw, ih = w - 2 * mx, h - 2 * my
+    half = STROKE * w / 2
+    segs = []
+    for p in paths:
+        pts = [(mx + x * iw, my + y * ih) for (x, y) in p]
+        segs += list(zip(pts, pts[1:]))
+
+    out = []
+    for y in range(h):
+        row = []
+        for x in range(w):
+            hits = 0
+            for sy in range(SUPERSAMPLE):
+                for sx in range(SUPERSAMPLE):
+                    px = x + (sx + 0.5) / SUPERSAMPLE
+                    py = y + (sy + 0.5) / SUPERSAMPLE
+                    if any(seg_dist(px, py, a[0], a[1], b[0], b[1]) <= half
+                           for (a, b) in segs):
+                        hits += 1
+            row.append(round(15 * hits / (SUPERSAMPLE * SUPERSAMPLE)))
+        out.append(row)
+    return out
+
+
+def emit(root):
+    hdr = os.path.join(root, 'Core', 'Inc', 'GFX_Digits.h')
+    src = os.path.join(root, 'Core', 'Src', 'GFX_Digits.c')
+
+    with open(hdr, 'w') as f:
+        f.write('''/*
+ * GFX_Digits.h
+ *
+ *  Generated by Tools/gen_digits.py - do not edit by hand.
+ */
+
+#ifndef INC_GFX_DIGITS_H_
+#define INC_GFX_DIGITS_H_
+
+#include <stdint.h>
+
+/* Large '0'-'9' glyphs for the numeric readout. Each glyph is w*h 4-bit
+ * coverage values (0 = background, 15 = foreground), row-major, two pixels
+ * per byte with the left pixel in the high nibble.
+ */
+typedef struct {
+    uint8_t w;
+    uint8_t h;
+    uint16_t glyph_bytes;
+    const uint8_t *bitmaps;     // 10 glyphs back to back, '0' first
+} GFX_DigitFont;
+
+''')
+        for (w, h) in SIZES:
+            f.write('extern const GFX_DigitFont GFX_Digits%dx%d;\n' % (w, h))
+        f.write('\n#endif /* INC_GFX_DIGITS_H_ */\n')
+
+    with open(src, 'w') as f:
+        f.write('''/*
+ * GFX_Digits.c
+ *
+ *  Generated by Tools/gen_digits.py - do not edit by hand.
+ */
+
+#include "GFX_Digits.h"
+''')
+        for (w, h) in SIZES:
+            name = 'digits_%dx%d' % (w, h)
+            f.write('\nstatic const uint8_t %s[10 * %d] = {\n' % (name, w * h // 2))
+            for d in '0123456789':
+                cov = rasterize(DIGITS[d], w, h)
+                f.write("    /* '%s' */\n" % d)
+                for row in cov:
+                    packed = [(row[i] << 4) | row[i + 1] for i in range(0, w, 2)]
+                    f.write('    ' + ','.join('0x%02X' % b for b in packed) + ',\n')
+            f.write('};\n')
+            f.write('\nconst GFX_DigitFont GFX_Digits%dx%d = {\n' % (w, h))
+            f.write('    %d, %d, %d, %s\n};\n' % (w, h, w * h // 2, name))
+
+
+if __name__ == '__main__':
+    emit(os.path.join(os.path.dirname(os.path.abspath(__file__)), '..'))
@@ -0,0 +1,485 @@
+/*
+ * ili9341_sim.c
+ *
+ *  Created on: Oct 17, 2026
+ *      Author: kings
+ */
+
+#include "ili9341_sim.h"
+#include "stm32l4xx_hal.h"
+#include "ILI9341_STM32.h"
+
+#include <stdio.h>
+#include <string.h>
+
+/* ======== Fake HAL objects ======== */
+
+GPIO_TypeDef SIM_GPIOA = { 'A' };
+GPIO_TypeDef SIM_GPIOB = { 'B' };
+GPIO_TypeDef SIM_GPIOC = { 'C' };
+
+SPI_HandleTypeDef hspi1 = { 1 };
+
+static uint32_t sim_tick = 0;
+
+/* ======== Panel state ======== */
+
+#define PANEL_LINES     ILI9341_TFTHEIGHT   // 320 gate lines (scroll axis)
+#define PANEL_SOURCES   ILI9341_TFTWIDTH    // 240 pixels per line
+
+static uint16_t mem[PANEL_LINES][PANEL_SOURCES];
+
+static uint8_t  cs_low = 0;
+static uint8_t  dc_data = 0;
+
+static uint8_t  cmd = 0;
+static uint8_t  args[8];
+static uint8_t  nargs = 0;
+
+static uint8_t  rotation = 0;
+static uint16_t xs, xe, ys, ye;             // window from CASET/PASET
+static uint16_t cx, cy;                     // RAMWR write position
+static uint8_t  px_hi;
+static uint8_t  px_half = 0;
+
+static uint16_t tfa = 0, vsa = PANEL_LINES, bfa = 0, vsp = 0;
+
+static SIM_Stats stats;
+
+/* Screen position in a rotation to panel (gate line, source). Rotations
+ * 0/1 run along the lines in order, 2/3 in reverse, matching the scroll
+ * mapping in the driver.
+ */
+static void to_panel(uint8_t rot, uint16_t x, uint16_t y,
+                     uint16_t *line, uint16_t *src)
+{
+    switch (rot) {
+    case 0:  *line = y;                   *src = x;                     break;
+    case 1:  *line = x;                   *src = y;                     break;
+    case 2:  *line = PANEL_LINES - 1 - y; *src = PANEL_SOURCES - 1 - x; break;
+    default: *line = PANEL_LINES - 1 - x; *src = PANEL_SOURCES - 1 - y; break;
+    }
+}
+
+static uint8_t madctl_rotation(uint8_t madctl)
+{
+    switch (madctl & 0xE0) {
+    case 0x20: return 1;    // MV
+    case 0x80: return 2;    // MY
+    case 0xE0: return 3;    // MY | MX | MV
+    default:   return 0;    // MX
+    }
+}
+
+static void write_pixel(uint16_t color)
+{
+    uint16_t line, src;
+
+    if ((cx < SIM_Width()) && (cy < SIM_Height())) {
+        to_panel(rotation, cx, cy, &line, &src);
+        mem[line][src] = color;
+    } else {
+        stats.errors++;
+    }
+    stats.pixels++;
+
+    if (++cx > xe) {
+        cx = xs;
+        if (++cy > ye) {
+            cy = ys;
+        }
+    }
+}
+
+static void command_byte(uint8_t b)
+{
+    stats.commands++;
+    cmd = b;
+    nargs = 0;
+    px_half = 0;
+
+    if (cmd == ILI9341_RAMWR) {
+        cx = xs;
+        cy = ys;
+    }
+}
+
+static void data_byte(uint8_t b)
+{
+    if (cmd == ILI9341_RAMWR) {
+        if (!px_half) {
+            px_hi = b;
+            px_half = 1;
+        } else {
+            write_pixel((uint16_t)((px_hi << 8) | b));
+            px_half = 0;
+        }
+        return;
+    }
+
+    if (nargs < sizeof(args)) {
+        args[nargs++] = b;
+    }
+
+    switch (cmd) {
+    case ILI9341_CASET:
+        if (nargs == 4) {
+            xs = (args[0] << 8) | args[1];
+            xe = (args[2] << 8) | args[3];
+        }
+        break;
+    case ILI9341_PASET:
+        if (nargs == 4) {
+            ys = (args[0] << 8) | args[1];
+            ye = (args[2] << 8) | args[3];
+        }
+        break;
+    case ILI9341_MADCTL:
+        rotation = madctl_rotation(args[0]);
+        break;
+    case ILI9341_VSCRDEF:
+        if (nargs == 6) {
+            tfa = (args[0] << 8) | args[1];
+            vsa = (args[2] << 8) | args[3];
+            bfa = (args[4] << 8) | args[5];
+            if (tfa + vsa + bfa != PANEL_LINES) {
+                stats.errors++;
+            }
+        }
+        break;
+    case ILI9341_VSCRSADD:
+        if (nargs == 2) {
+            vsp = (args[0] << 8) | args[1];
+        }
+        break;
+    default:
+        break;
+    }
+}
+
+static void spi_bytes(const uint8_t *data, uint16_t size)
+{
+    stats.transfers++;
+    stats.bytes += size;
+
+    for (uint16_t i = 0; i < size; i++) {
+        if (!cs_low) {
+            stats.errors++;
+        } else if (dc_data) {
+            data_byte(data[i]);
+        } else {
+            command_byte(data[i]);
+        }
+    }
+}
+
+/* ======== Fake HAL ======== */
+
+void HAL_Delay(uint32_t Delay)
+{
+    sim_tick += Delay;
+}
+
+uint32_t HAL_GetTick(void)
+{
+    return sim_tick;
+}
+
+void HAL_GPIO_WritePin(GPIO_TypeDef *GPIOx, uint16_t GPIO_Pin, GPIO_PinState PinState)
+{
+    stats.gpio_writes++;
+
+    if ((GPIOx == ILI9341_CS_GPIO_Port) && (GPIO_Pin == ILI9341_CS_Pin)) {
+        uint8_t low = (PinState == GPIO_PIN_RESET);
+        if (cs_low && !low) {
+            stats.cs_cycles++;
+        }
+        cs_low = low;
+    } else if ((GPIOx == ILI9341_DC_GPIO_Port) && (GPIO_Pin == ILI9341_DC_Pin)) {
+        dc_data = (PinState == GPIO_PIN_SET);
+    }
+}
+
+HAL_StatusTypeDef HAL_SPI_Transmit(SPI_HandleTypeDef *hspi, uint8_t *pData,
+                                   uint16_t Size, uint32_t Timeout)
+{
+    (void)Timeout;
+    if (hspi != &hspi1) return HAL_ERROR;
+
+    spi_bytes(pData, Size);
+    return HAL_OK;
+}
+
+/* DMA completes instantly, as soon as interrupts allow. The completion
+ * callback usually starts the next transfer, so callbacks are run from a
+ * loop rather than nested: the driver's whole chain drains before the
+ * drawing call returns.
+ */
+static uint8_t irq_masked = 0;
+static uint8_t in_irq = 0;
+static uint32_t dma_pending = 0;
+
+static void run_dma_irqs(void)
+{
+    if (in_irq || irq_masked) {
+        return;
+    }
+
+    in_irq = 1;
+    while (dma_pending) {
+        dma_pending--;
+        HAL_SPI_TxCpltCallback(&hspi1);
+    }
+    in_irq = 0;
+}
+
+void __disable_irq(void)
+{
+    irq_masked = 1;
+}
+
+void __enable_irq(void)
+{
+    irq_masked = 0;
+    run_dma_irqs();
+}
+
+uint32_t __get_PRIMASK(void)
+{
+    return irq_masked;
+}
+
+void __set_PRIMASK(uint32_t primask)
+{
+    if (primask) {
+        __disable_irq();
+    } else {
+        __enable_irq();
+    }
+}
+
+HAL_StatusTypeDef HAL_SPI_Transmit_DMA(SPI_HandleTypeDef *hspi, uint8_t *pData,
+                                       uint16_t Size)
+{
+    if (hspi != &hspi1) return HAL_ERROR;
+
+    if (dma_pending) {
+        stats.errors++;     // new transfer before the last one completed
+    }
+
+    stats.dma_transfers++;
+    spi_bytes(pData, Size);
+    dma_pending++;
+
+    run_dma_irqs();
+    return HAL_OK;
+}
+
+/* ======== Simulator API ======== */
+
+void SIM_Reset(void)
+{
+    memset(mem, 0, sizeof(mem));
+    cs_low = 0;
+    dc_data = 0;
+    cmd = 0;
+    nargs = 0;
+    px_half = 0;
+    rotation = 0;
+    xs = ys = 0;
+    xe = PANEL_SOURCES - 1;
+    ye = PANEL_LINES - 1;
+    tfa = 0;
+    vsa = PANEL_LINES;
+    bfa = 0;
+    vsp = 0;
+    SIM_ResetStats();
+}
+
+void SIM_GetStats(SIM_Stats *s)
+{
+    *s = stats;
+}
+
+void SIM_ResetStats(void)
+{
+    SIM_Stats zero = {0};
+    stats = zero;
+}
+
+uint16_t SIM_Width(void)
+{
+    return (rotation & 1) ? PANEL_LINES : PANEL_SOURCES;
+}
+
+uint16_t SIM_Height(void)
+{
+    return (rotation & 1) ? PANEL_SOURCES : PANEL_LINES;
+}
+
+uint16_t SIM_GetPixel(uint16_t x, uint16_t y)
+{
+    uint16_t line, src;
+
+    to_panel(rotation, x, y, &line, &src);
+
+    /* Inside the scroll area, display line d shows memory line
+     * tfa + (vsp - tfa + d - tfa) % vsa.
+     */
+    if ((vsa > 0) && (line >= tfa) && (line < tfa + vsa)) {
+        uint16_t start = (vsp >= tfa) ? (vsp - tfa) : 0;
+        line = tfa + (start + (line - tfa)) % vsa;
+    }
+    return mem[line][src];
+}
+
+uint32_t SIM_FrameCRC(void)
+{
+    uint32_t crc = 0xFFFFFFFFU;
+
+    for (uint16_t y = 0; y < SIM_Height(); y++) {
+        for (uint16_t x = 0; x < SIM_Width(); x++) {
+            uint16_t c = SIM_GetPixel(x, y);
+            for (uint8_t k = 0; k < 2; k++) {
+                crc ^= (k ? (c & 0xFF) : (c >> 8));
+                for (uint8_t b = 0; b < 8; b++) {
+                    crc = (crc >> 1) ^ (0xEDB88320U & (0U - (crc & 1U)));
+                }
+            }
+        }
+    }
+    return ~crc;
+}
+
+/* ======== Snapshots ======== */
+
+static void rgb888(uint16_t c, uint8_t *out)
+{
+    uint8_t r = (c >> 11) & 0x1F, g = (c >> 5) & 0x3F, b = c & 0x1F;
+
+    out[0] = (uint8_t)((r << 3) | (r >> 2));
+    out[1] = (uint8_t)((g << 2) | (g >> 4));
+    out[2] = (uint8_t)((b << 3) | (b >> 2));
+}
+
+int SIM_WritePPM(const char *path)
+{
+    FILE *f = fopen(path, "wb");
+    if (!f) return -1;
+
+    fprintf(f, "P6\n%u %u\n255\n", SIM_Width(), SIM_Height());
+    for (uint16_t y = 0; y < SIM_Height(); y++) {
+        for (uint16_t x = 0; x < SIM_Width(); x++) {
+            uint8_t px[3];
+            rgb888(SIM_GetPixel(x, y), px);
+            fwrite(px, 1, 3, f);
+        }
+    }
+    return fclose(f) ? -1 : 0;
+}
+
+/* PNG without zlib: the image data goes out as stored (uncompressed)
+ * deflate blocks, so only CRC-32 and Adler-32 are needed.
+ */
+static uint32_t png_crc_table[256];
+
+static uint32_t png_crc(uint32_t crc, const uint8_t *p, size_t n)
+{
+    if (!png_crc_table[1]) {
+        for (uint32_t i = 0; i < 256; i++) {
+            uint32_t c = i;
+            for (uint8_t k = 0; k < 8; k++) {
+                c = (c & 1) ? (0xEDB88320U ^ (c >> 1)) : (c >> 1);
+            }
+            png_crc_table[i] = c;
+        }
+    }
+    while (n--) {
+        crc = png_crc_table[(crc ^ *p++) & 0xFF] ^ (crc >> 8);
+    }
+    return crc;
+}
+
+static void put_be32(uint8_t *p, uint32_t v)
+{
+    p[0] = v >> 24;
+    p[1] = v >> 16;
+    p[2] = v >> 8;
+    p[3] = v;
+}
+
+static void png_chunk(FILE *f, const char *type, const uint8_t *data, uint32_t len)
+{
+    uint8_t hdr[8];
+    uint8_t tail[4];
+
+    put_be32(hdr, len);
+    memcpy(hdr + 4, type, 4);
+    fwrite(hdr, 1, 8, f);
+    if (len) fwrite(data, 1, len, f);
+
+    uint32_t crc = png_crc(0xFFFFFFFFU, hdr + 4, 4);
+    crc = png_crc(crc, data, len);
+    put_be32(tail, ~crc);
+    fwrite(tail, 1, 4, f);
+}
+
+int SIM_WritePNG(const char *path)
+{
+    static const uint8_t sig[8] = { 0x89, 'P', 'N', 'G', '\r', '\n', 0x1A, '\n' };
+    static uint8_t raw[PANEL_LINES * (1 + PANEL_SOURCES * 3)];
+    static uint8_t idat[sizeof(raw) + sizeof(raw) / 65535 * 5 + 16];
+
+    uint16_t w = SIM_Width(), h = SIM_Height();
+    uint32_t raw_len = 0;
+
+    for (uint16_t y = 0; y < h; y++) {
+        raw[raw_len++] = 0;                 // filter: none
+        for (uint16_t x = 0; x < w; x++) {
+            rgb888(SIM_GetPixel(x, y), &raw[raw_len]);
+            raw_len += 3;
+        }
+    }
+
+    /* zlib stream: header, stored blocks, Adler-32 */
+    uint32_t n = 0, a = 1, b = 0;
+    idat[n++] = 0x78;
+    idat[n++] = 0x01;
+    for (uint32_t pos = 0; pos < raw_len; ) {
+        uint32_t len = raw_len - pos;
+        if (len > 65535U) len = 65535U;
+
+        idat[n++] = (pos + len == raw_len) ? 1 : 0;
+        idat[n++] = len & 0xFF;
+        idat[n++] = len >> 8;
+        idat[n++] = ~len & 0xFF;
+        idat[n++] = (~len >> 8) & 0xFF;
+        memcpy(&idat[n], &raw[pos], len);
+        n += len;
+        pos += len;
+    }
+    for (uint32_t i = 0; i < raw_len; i++) {
+        a = (a + raw[i]) % 65521U;
+        b = (b + a) % 65521U;
+    }
+    put_be32(&idat[n], (b << 16) | a);
+    n += 4;
+
+    uint8_t ihdr[13];
+    put_be32(ihdr, w);
+    put_be32(ihdr + 4, h);
+    ihdr[8]  = 8;       // bit depth
+    ihdr[9]  = 2;       // truecolor RGB
+    ihdr[10] = 0;
+    ihdr[11] = 0;
+    ihdr[12] = 0;
+
+    FILE *f = fopen(path, "wb");
+    if (!f) return -1;
+
+    fwrite(sig, 1, sizeof(sig), f);
+    png_chunk(f, "IHDR", ihdr, sizeof(ihdr));
+    png_chunk(f, "IDAT", idat, n);
+    png_chunk(f, "IEND", NULL, 0);
+    return fclose(f) ? -1 : 0;
+}
@@ -0,0 +1,45 @@
+/*
+ * ili9341_sim.h
+ *
+ *  Created on: Oct 17, 2026
+ *      Author: kings
+ *
+ *  Simulated ILI9341 behind the fake HAL SPI/GPIO calls. It decodes the
+ *  command stream the driver sends (CASET/PASET/RAMWR, MADCTL, VSCRDEF,
+ *  VSCRSADD) into panel memory, so frames can be checked on a PC.
+ */
+
+#ifndef ILI9341_SIM_H_
+#define ILI9341_SIM_H_
+
+#include <stdint.h>
+
+/* Traffic seen at the HAL boundary */
+typedef struct {
+    uint32_t transfers;     // HAL_SPI_Transmit + HAL_SPI_Transmit_DMA calls
+    uint32_t dma_transfers; // of which DMA
+    uint32_t bytes;         // bytes clocked out
+    uint32_t gpio_writes;   // HAL_GPIO_WritePin calls
+    uint32_t cs_cycles;     // CS low -> high
+    uint32_t commands;      // command bytes (DC low)
+    uint32_t pixels;        // pixels written by RAMWR
+    uint32_t errors;        // bytes with CS high, bad scroll setup, ...
+} SIM_Stats;
+
+/* Power-on state: black memory, no scroll, rotation 0 */
+void SIM_Reset(void);
+
+void SIM_GetStats(SIM_Stats *stats);
+void SIM_ResetStats(void);
+
+/* What the panel shows, in the current rotation (scrolling applied) */
+uint16_t SIM_Width(void);
+uint16_t SIM_Height(void);
+uint16_t SIM_GetPixel(uint16_t x, uint16_t y);
+uint32_t SIM_FrameCRC(void);
+
+/* Snapshots of the displayed frame; return 0 on success */
+int SIM_WritePPM(const char *path);
+int SIM_WritePNG(const char *path);
+
+#endif /* ILI9341_SIM_H_ */
@@ -0,0 +1,164 @@
+/*
+ * lcd_sim_main.c
+ *
+ *  Created on: Oct 17, 2026
+ *      Author: kings
+ *
+ *  Runs the LCD UI against the simulated panel: prints the SPI cost of each
+ *  UI call and writes snapshots of the frames it produces, at the ADC block
+ *  rate and then at the spot sampling rate.
+ *
+ *      lcd_sim [output-dir]
+ *
+ *  Exits non-zero if the panel saw malformed traffic or the driver's own
+ *  bus counters disagree with what arrived at the HAL.
+ */
+
+#include "ili9341_sim.h"
+#include "ILI9341_STM32.h"
+#include "lcd_ui.h"
+
+#include <math.h>
+#include <stdio.h>
+
+#define SIM_SAMPLES     600
+#define SIM_SPOT_SAMPLES 120
+
+static const char *out_dir = ".";
+static int failures = 0;
+
+static SIM_Stats        sim_before;
+static ILI9341_BusStats bus_before;
+
+/* ======== Cost accounting ======== */
+
+static void measure_begin(void)
+{
+    SIM_GetStats(&sim_before);
+    ILI9341_GetBusStats(&bus_before);
+}
+
+static void measure_end(const char *label)
+{
+    SIM_Stats s;
+    ILI9341_BusStats b;
+
+    SIM_GetStats(&s);
+    ILI9341_GetBusStats(&b);
+
+    uint32_t bytes   = s.bytes - sim_before.bytes;
+    uint32_t windows = b.windows - bus_before.windows;
+
+    printf("%-30s %7lu %9lu %6lu %5lu %7lu %8lu\n", label,
+           (unsigned long)(s.transfers - sim_before.transfers),
+           (unsigned long)bytes,
+           (unsigned long)(s.gpio_writes - sim_before.gpio_writes),
+           (unsigned long)(s.cs_cycles - sim_before.cs_cycles),
+           (unsigned long)windows,
+           (unsigned long)(s.pixels - sim_before.pixels));
+
+    if (bytes != b.bytes - bus_before.bytes) {
+        printf("  ! driver counted %lu bytes\n",
+               (unsigned long)(b.bytes - bus_before.bytes));
+        failures++;
+    }
+    if (s.errors != sim_before.errors) {
+        printf("  ! %lu protocol errors\n",
+               (unsigned long)(s.errors - sim_before.errors));
+        failures++;
+    }
+}
+
+#define MEASURE(label, call)    \
+    do {                        \
+        measure_begin();        \
+        call;                   \
+        measure_end(label);     \
+    } while (0)
+
+static void snapshot(const char *name)
+{
+    char path[256];
+
+    snprintf(path, sizeof(path), "%s/%s.png", out_dir, name);
+    if (SIM_WritePNG(path)) {
+        printf("  ! cannot write %s\n", path);
+        failures++;
+    }
+    snprintf(path, sizeof(path), "%s/%s.ppm", out_dir, name);
+    if (SIM_WritePPM(path)) {
+        printf("  ! cannot write %s\n", path);
+        failures++;
+    }
+    printf("frame %-24s %ux%u crc %08lX\n", name, SIM_Width(), SIM_Height(),
+           (unsigned long)SIM_FrameCRC());
+}
+
+/* ======== Scenario ======== */
+
+/* Synthetic ADC reading: slow drift with a faster wobble */
+static uint16_t sample_at(uint32_t i)
+{
+    double v = 2048.0 + 900.0 * sin(i / 40.0) + 200.0 * sin(i / 7.0);
+    return (uint16_t)v;
+}
+
+int main(int argc, char **argv)
+{
+    if (argc > 1) {
+        out_dir = argv[1];
+    }
+
+    SIM_Reset();
+
+    printf("%-30s %7s %9s %6s %5s %7s %8s\n", "call",
+           "xfers", "bytes", "gpio", "cs", "windows", "pixels");
+
+    MEASURE("LCD_UI_Init", LCD_UI_Init());
+    MEASURE("LCD_UI_SetLabel", LCD_UI_SetLabel("Glucose (mg/dL)"));
+
+    for (uint32_t i = 0; i < SIM_SAMPLES; i++) {
+        uint16_t v = sample_at(i);
+
+        if (i == SIM_SAMPLES - 1) {
+            MEASURE("LCD_UI_UpdateCurrentValue", LCD_UI_UpdateCurrentValue(v));
+            MEASURE("LCD_UI_AddSample", LCD_UI_AddSample(v));
+            MEASURE("LCD_UI_Flush", LCD_UI_Flush());
+        } else {
+            LCD_UI_UpdateCurrentValue(v);
+            LCD_UI_AddSample(v);
+            LCD_UI_Flush();
+        }
+    }
+    snapshot("trend_5min");
+
+    MEASURE("LCD_UI_SetTrendWindow(1H)",
+            { LCD_UI_SetTrendWindow(LCD_UI_TREND_1H); LCD_UI_Flush(); });
+    snapshot("trend_1h");
+
+    MEASURE("LCD_UI_SetTrendWindow(8H)",
+            { LCD_UI_SetTrendWindow(LCD_UI_TREND_8H); LCD_UI_Flush(); });
+    snapshot("trend_8h");
+
+    // Spot sampling, one reading per 5 s: 10 min of them, so the 5 min
+    // window has scrolled by half and each reading is several columns
+    MEASURE("LCD_UI_SetSamplePeriod(5000)",
+            { LCD_UI_SetSamplePeriod(5000); LCD_UI_SetTrendWindow(LCD_UI_TREND_5MIN); });
+    for (uint32_t i = 0; i < SIM_SPOT_SAMPLES; i++) {
+        uint16_t v = sample_at(i * 10U);
+
+        if (i == SIM_SPOT_SAMPLES - 1) {
+            MEASURE("LCD_UI_AddSample (spot)", { LCD_UI_AddSample(v); LCD_UI_Flush(); });
+        } else {
+            LCD_UI_AddSample(v);
+            LCD_UI_Flush();
+        }
+    }
+    snapshot("spot_5min");
+
+    if (failures) {
+        printf("%d check(s) failed\n", failures);
+        return 1;
+    }
+    return 0;
+}
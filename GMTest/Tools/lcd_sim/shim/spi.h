@@ -0,0 +1,17 @@
+/*
+ * spi.h
+ *
+ *  Created on: Oct 17, 2026
+ *      Author: kings
+ *
+ *  Host stand-in for the CubeMX spi.h.
+ */
+
+#ifndef SIM_SPI_H_
+#define SIM_SPI_H_
+
+#include "stm32l4xx_hal.h"
+
+extern SPI_HandleTypeDef hspi1;
+
+#endif /* SIM_SPI_H_ */
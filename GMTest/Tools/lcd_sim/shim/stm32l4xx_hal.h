@@ -0,0 +1,83 @@
+/*
+ * stm32l4xx_hal.h
+ *
+ *  Created on: Oct 17, 2026
+ *      Author: kings
+ *
+ *  Host stand-in for the HAL header: just the types, constants and calls
+ *  the LCD stack uses. SPI and GPIO traffic goes to the simulated panel in
+ *  ili9341_sim.c.
+ */
+
+#ifndef SIM_STM32L4XX_HAL_H_
+#define SIM_STM32L4XX_HAL_H_
+
+#include <stdint.h>
+#include <stddef.h>
+
+typedef enum {
+    HAL_OK      = 0x00U,
+    HAL_ERROR   = 0x01U,
+    HAL_BUSY    = 0x02U,
+    HAL_TIMEOUT = 0x03U
+} HAL_StatusTypeDef;
+
+typedef enum {
+    GPIO_PIN_RESET = 0U,
+    GPIO_PIN_SET
+} GPIO_PinState;
+
+typedef struct {
+    char name;
+} GPIO_TypeDef;
+
+typedef struct {
+    uint32_t id;
+} SPI_HandleTypeDef;
+
+extern GPIO_TypeDef SIM_GPIOA, SIM_GPIOB, SIM_GPIOC;
+
+#define GPIOA               (&SIM_GPIOA)
+#define GPIOB               (&SIM_GPIOB)
+#define GPIOC               (&SIM_GPIOC)
+
+#define GPIO_PIN_0          ((uint16_t)0x0001)
+#define GPIO_PIN_1          ((uint16_t)0x0002)
+#define GPIO_PIN_2          ((uint16_t)0x0004)
+#define GPIO_PIN_3          ((uint16_t)0x0008)
+#define GPIO_PIN_4          ((uint16_t)0x0010)
+#define GPIO_PIN_5          ((uint16_t)0x0020)
+#define GPIO_PIN_6          ((uint16_t)0x0040)
+#define GPIO_PIN_7          ((uint16_t)0x0080)
+#define GPIO_PIN_8          ((uint16_t)0x0100)
+#define GPIO_PIN_9          ((uint16_t)0x0200)
+#define GPIO_PIN_10         ((uint16_t)0x0400)
+#define GPIO_PIN_11         ((uint16_t)0x0800)
+#define GPIO_PIN_12         ((uint16_t)0x1000)
+#define GPIO_PIN_13         ((uint16_t)0x2000)
+#define GPIO_PIN_14         ((uint16_t)0x4000)
+#define GPIO_PIN_15         ((uint16_t)0x8000)
+
+#define HAL_MAX_DELAY       0xFFFFFFFFU
+
+/* PRIMASK: DMA completions are held back while interrupts are masked */
+void __disable_irq(void);
+void __enable_irq(void);
+uint32_t __get_PRIMASK(void);
+void __set_PRIMASK(uint32_t primask);
+
+void HAL_Delay(uint32_t Delay);
+uint32_t HAL_GetTick(void);
+
+void HAL_GPIO_WritePin(GPIO_TypeDef *GPIOx, uint16_t GPIO_Pin, GPIO_PinState PinState);
+
+HAL_StatusTypeDef HAL_SPI_Transmit(SPI_HandleTypeDef *hspi, uint8_t *pData,
+                                   uint16_t Size, uint32_t Timeout);
+HAL_StatusTypeDef HAL_SPI_Transmit_DMA(SPI_HandleTypeDef *hspi, uint8_t *pData,
+                                       uint16_t Size);
+
+/* Implemented by the driver, called by the simulated DMA */
+void HAL_SPI_TxCpltCallback(SPI_HandleTypeDef *hspi);
+void HAL_SPI_ErrorCallback(SPI_HandleTypeDef *hspi);
+
+#endif /* SIM_STM32L4XX_HAL_H_ */
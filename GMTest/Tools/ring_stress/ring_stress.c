@@ -0,0 +1,216 @@
+/*
+ * ring_stress.c
+ *
+ *  Created on: Oct 17, 2026
+ *      Author: kings
+ *
+ *  Pushes numbered samples through the ADC sample ring (sample_ring.c)
+ *  from a producer thread while the main thread consumes them, both at
+ *  uneven speeds so the ring keeps running empty and full. Every sample
+ *  carries its number as the tick and a hash of it as the value. Checks
+ *
+ *    - samples come out in order, none twice, each whole (tick and value
+ *      from the same push, no stray flags);
+ *    - SRING_FLAG_GAP on exactly the samples after a drop;
+ *    - SRING_FLAG_OVERRUN (SRING_MarkNext) on the first sample that got in
+ *      after each mark, even when the marked one was dropped;
+ *    - SRING_Pop and SRING_Read (batches) agree, and the stats add up.
+ *
+ *      ring_stress [samples [seed]]
+ *
+ *  Exits non-zero on the first failed check.
+ */
+
+#include "sample_ring.h"
+
+#include <pthread.h>
+#include <sched.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+
+#define RING_LEN        64U     // small, so it wraps and fills all the time
+#define OVERRUN_EVERY   997U    // the producer marks before these samples
+#define MAX_BATCH       48U
+
+static SRING_Sample ring_buf[RING_LEN];
+static SRING_Ring   ring;
+
+static uint32_t n_samples;
+static volatile uint32_t producer_done;
+
+/* Value for a tick, so a torn sample shows */
+static uint16_t value_of(uint32_t tick)
+{
+    tick *= 2654435761U;
+    return (uint16_t)(tick >> 16);
+}
+
+static uint32_t rnd(uint32_t *s)
+{
+    *s ^= *s << 13;
+    *s ^= *s >> 17;
+    *s ^= *s << 5;
+    return *s;
+}
+
+/* Spends a little time, as a busy main loop or a slow IRQ would */
+static void stall(uint32_t spins)
+{
+    for (volatile uint32_t i = 0; i < spins; i++) {
+    }
+}
+
+/* ======== Producer: the DMA IRQ ======== */
+
+static uint32_t producer_seed;
+
+static void *producer(void *arg)
+{
+    (void)arg;
+
+    for (uint32_t tick = 1; tick <= n_samples; tick++) {
+        uint32_t r = rnd(&producer_seed);
+
+        if (tick % OVERRUN_EVERY == 0U) {
+            SRING_MarkNext(&ring, SRING_FLAG_OVERRUN);
+        }
+        SRING_Push(&ring, tick, value_of(tick), 0);
+
+        // Hand the CPU over at random points, so one core interleaves the
+        // two sides too; now and then a pause long enough to drain the ring
+        if ((r & 0x1FU) == 0U) sched_yield();
+        if ((r & 0xFFFU) == 0U) stall(r >> 20);
+    }
+    __atomic_store_n(&producer_done, 1U, __ATOMIC_RELEASE);
+    return NULL;
+}
+
+/* ======== Consumer: the main loop ======== */
+
+static uint32_t consumed, gaps, overruns, pops, reads;
+static uint32_t last_tick;
+static uint32_t failures;
+
+#define CHECK(cond, ...) do {                                   \
+        if (!(cond)) {                                          \
+            printf("FAIL %s:%d: ", __FILE__, __LINE__);         \
+            printf(__VA_ARGS__);                                \
+            printf("\n");                                       \
+            failures++;                                         \
+            return;                                             \
+        }                                                       \
+    } while (0)
+
+static void check_sample(const SRING_Sample *s)
+{
+    CHECK(s->tick > last_tick && s->tick <= n_samples,
+          "sample %u after %u: out of order or duplicated", s->tick, last_tick);
+    CHECK(s->raw == value_of(s->tick),
+          "sample %u torn: value 0x%04X, expected 0x%04X", s->tick, s->raw,
+          value_of(s->tick));
+    CHECK((s->flags & ~(SRING_FLAG_GAP | SRING_FLAG_OVERRUN)) == 0U,
+          "sample %u has stray flags 0x%04X", s->tick, s->flags);
+
+    // The first sample is flagged as after a gap too: nothing came before
+    uint8_t gap = (s->tick != last_tick + 1U) || (last_tick == 0U);
+    CHECK(!!(s->flags & SRING_FLAG_GAP) == gap, "sample %u after %u: gap flag %s",
+          s->tick, last_tick, gap ? "missing" : "set without a drop");
+
+    // A mark lands on the first sample in at or after the marked one
+    uint8_t marked = (s->tick / OVERRUN_EVERY) != (last_tick / OVERRUN_EVERY);
+    CHECK(!!(s->flags & SRING_FLAG_OVERRUN) == marked,
+          "sample %u after %u: overrun flag %s", s->tick, last_tick,
+          marked ? "missing" : "set without a mark");
+
+    gaps     += gap;
+    overruns += marked;
+    consumed++;
+    last_tick = s->tick;
+}
+
+static void consume(uint32_t seed)
+{
+    SRING_Sample batch[MAX_BATCH];
+
+    for (;;) {
+        uint8_t done = __atomic_load_n(&producer_done, __ATOMIC_ACQUIRE);
+        uint32_t r = rnd(&seed);
+
+        CHECK(SRING_Count(&ring) <= RING_LEN, "%u samples in a %u-slot ring",
+              SRING_Count(&ring), RING_LEN);
+
+        if (r & 1U) {
+            SRING_Sample s;
+            while (SRING_Pop(&ring, &s)) {
+                pops++;
+                check_sample(&s);
+                if (failures) return;
+                if ((rnd(&seed) & 0x3FU) == 0U) break;
+            }
+        } else {
+            uint32_t n = SRING_Read(&ring, batch, 1U + (r >> 8) % MAX_BATCH);
+            reads += (n > 0U);
+            for (uint32_t i = 0; i < n; i++) {
+                check_sample(&batch[i]);
+                if (failures) return;
+            }
+        }
+
+        // Sometimes busy for longer than the ring lasts
+        if ((r & 0x3FF0U) == 0U) stall((r >> 16) & 0x3FFFU);
+
+        if (done && (SRING_Count(&ring) == 0U)) break;
+        if (SRING_Count(&ring) == 0U) sched_yield();
+    }
+}
+
+int main(int argc, char **argv)
+{
+    uint32_t seed = (argc > 2) ? (uint32_t)strtoul(argv[2], NULL, 0) : 1U;
+    pthread_t th;
+    struct timespec t0, t1;
+    SRING_Stats st;
+
+    n_samples = (argc > 1) ? (uint32_t)strtoul(argv[1], NULL, 0) : 5000000U;
+    producer_seed = seed ? seed : 1U;
+
+    SRING_Init(&ring, ring_buf, RING_LEN);
+    clock_gettime(CLOCK_MONOTONIC, &t0);
+    if (pthread_create(&th, NULL, producer, NULL) != 0) return 2;
+    consume(producer_seed * 2654435761U | 1U);
+    pthread_join(th, NULL);
+    clock_gettime(CLOCK_MONOTONIC, &t1);
+
+    SRING_GetStats(&ring, &st);
+    double secs = (t1.tv_sec - t0.tv_sec) + (t1.tv_nsec - t0.tv_nsec) / 1e9;
+    printf("%u samples through %u slots in %.2f s (seed %u)\n",
+           n_samples, RING_LEN, secs, seed);
+    printf("consumed %u (%u pops, %u batch reads), dropped %u, high water %u\n",
+           consumed, pops, reads, st.dropped, st.high_water);
+    printf("gaps flagged %u, overrun marks seen %u of %u\n",
+           gaps, overruns, n_samples / OVERRUN_EVERY);
+
+    if (!failures) {
+        if (st.pushed != consumed) {
+            printf("FAIL %u pushed, %u consumed\n", st.pushed, consumed);
+            failures++;
+        }
+        if (st.pushed + st.dropped != n_samples) {
+            printf("FAIL %u pushed + %u dropped, %u produced\n",
+                   st.pushed, st.dropped, n_samples);
+            failures++;
+        }
+        if (st.high_water > RING_LEN) {
+            printf("FAIL high water %u in %u slots\n", st.high_water, RING_LEN);
+            failures++;
+        }
+        if ((st.dropped == 0U) || (gaps < 2U)) {
+            printf("FAIL the ring never filled; the run proves little\n");
+            failures++;
+        }
+    }
+
+    printf(failures ? "FAILED\n" : "OK\n");
+    return failures ? 1 : 0;
+}
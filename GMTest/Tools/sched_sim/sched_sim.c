@@ -0,0 +1,325 @@
+/*
+ * sched_sim.c
+ *
+ *  Created on: Oct 17, 2026
+ *      Author: kings
+ *
+ *  Runs the main loop scheduler (sched.c) on a simulated clock: a 1 ms
+ *  tick, an 80 MHz cycle counter and interrupts that signal events at set
+ *  times. Task bodies spend simulated time instead of doing work. Checks
+ *
+ *    - the order released tasks run in (priority, deadline, table order);
+ *    - periodic releases, events passed to tasks, skipped periods;
+ *    - SCHED_Pending, the check before sleeping;
+ *    - the main loop shape: a slow display task delays the reading task
+ *      by at most one display run, and a deadline is missed once that run
+ *      is longer than the deadline; execution times come out as spent.
+ *
+ *      sched_sim [seconds]
+ *
+ *  Exits non-zero on the first failed check.
+ */
+
+#include "sched.h"
+#include "stm32l4xx_hal.h"
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#define CYCLES_PER_MS   80000U
+#define MAX_IRQS        4U
+#define MAX_TRACE       64U
+
+static uint32_t failures;
+
+#define CHECK(cond, ...) do {                                   \
+        if (!(cond)) {                                          \
+            printf("FAIL %s:%d: ", __FILE__, __LINE__);         \
+            printf(__VA_ARGS__);                                \
+            printf("\n");                                       \
+            failures++;                                         \
+            return;                                             \
+        }                                                       \
+    } while (0)
+
+/* ======== Simulated clock ======== */
+
+SIM_CoreDebug_Type SIM_CoreDebug;
+SIM_DWT_Type       SIM_DWT;
+
+static uint32_t tick;
+static uint32_t primask;
+
+typedef struct {
+    uint32_t period;
+    uint32_t next;
+    uint32_t events;
+} SimIrq;
+
+static SimIrq   irqs[MAX_IRQS];
+static uint32_t n_irqs;
+
+void __disable_irq(void)          { primask = 1; }
+void __enable_irq(void)           { primask = 0; }
+uint32_t __get_PRIMASK(void)      { return primask; }
+void __set_PRIMASK(uint32_t p)    { primask = p; }
+uint32_t HAL_GetTick(void)        { return tick; }
+
+static void sim_reset(void)
+{
+    tick = 1000;                    // not 0, so nothing lines up by luck
+    SIM_DWT.CYCCNT = 0x12345678;
+    n_irqs = 0;
+    primask = 0;
+}
+
+/* An interrupt signalling events every period ms from first on */
+static void sim_irq(uint32_t first, uint32_t period, uint32_t events)
+{
+    irqs[n_irqs++] = (SimIrq){ period, first, events };
+}
+
+/* Time passes, in the main loop or in a task */
+static void sim_spend(uint32_t ms)
+{
+    while (ms--) {
+        tick++;
+        SIM_DWT.CYCCNT += CYCLES_PER_MS;
+        for (uint32_t i = 0; i < n_irqs; i++) {
+            if ((int32_t)(tick - irqs[i].next) >= 0) {
+                SCHED_Signal(irqs[i].events);
+                irqs[i].next += irqs[i].period;
+            }
+        }
+    }
+}
+
+/* The main loop: run what is released, else idle a tick, for ms ticks and
+ * everything released at the last one
+ */
+static void sim_run(uint32_t ms)
+{
+    uint32_t end = tick + ms;
+
+    while ((int32_t)(tick - end) <= 0) {
+        if (!SCHED_RunOne()) {
+            __disable_irq();
+            uint8_t work = SCHED_Pending();
+            __enable_irq();
+            if (!work) sim_spend(1);
+        }
+    }
+}
+
+/* ======== Task bodies ======== */
+
+static char     trace[MAX_TRACE];
+static uint32_t n_trace;
+static uint32_t last_events[SCHED_MAX_TASKS];
+static uint32_t spend_ms[SCHED_MAX_TASKS];
+static uint32_t signal_after[SCHED_MAX_TASKS];
+
+#define TASK_FN(i) \
+    static void task_##i(uint32_t events) \
+    { \
+        if (n_trace < MAX_TRACE - 1U) trace[n_trace++] = 'A' + i; \
+        last_events[i] = events; \
+        sim_spend(spend_ms[i]); \
+        if (signal_after[i]) SCHED_Signal(signal_after[i]); \
+    }
+TASK_FN(0) TASK_FN(1) TASK_FN(2) TASK_FN(3) TASK_FN(4) TASK_FN(5)
+
+static const SCHED_TaskFn task_fns[] = {
+    task_0, task_1, task_2, task_3, task_4, task_5,
+};
+
+static SCHED_Task defs[SCHED_MAX_TASKS];
+
+static void setup(void)
+{
+    sim_reset();
+    SCHED_Init();
+    memset(trace, 0, sizeof(trace));
+    n_trace = 0;
+    memset(last_events, 0, sizeof(last_events));
+    memset(spend_ms, 0, sizeof(spend_ms));
+    memset(signal_after, 0, sizeof(signal_after));
+}
+
+static int8_t add(uint32_t i, uint8_t prio, uint32_t events, uint32_t period,
+                  uint32_t deadline)
+{
+    static const char *names[] = { "A", "B", "C", "D", "E", "F" };
+    defs[i] = (SCHED_Task){ names[i], task_fns[i], prio, events, period, deadline };
+    return SCHED_Add(&defs[i]);
+}
+
+/* ======== Tests ======== */
+
+static void test_order(void)
+{
+    setup();
+    add(0, 2, 1U << 0, 0, 0);
+    add(1, 0, 1U << 1, 0, 0);
+    add(2, 1, 1U << 2, 0, 50);
+    add(3, 1, 1U << 3, 0, 20);
+    add(4, 1, 1U << 4, 0, 0);
+    add(5, 1, 1U << 5, 0, 20);      // ties with D, added after it
+
+    SCHED_Signal(0x3F);
+    while (SCHED_RunOne()) {
+    }
+    CHECK(strcmp(trace, "BDFCEA") == 0, "order %s, expected BDFCEA", trace);
+    CHECK(SCHED_Add(&defs[0]) >= 0, "table full too early");
+    CHECK(SCHED_Add(&defs[0]) >= 0, "table full too early");
+    CHECK(SCHED_Add(&defs[0]) == -1, "table took more than SCHED_MAX_TASKS");
+    printf("order: %s\n", trace);
+}
+
+static void test_periodic(void)
+{
+    SCHED_Stats st;
+
+    setup();
+    int8_t p = add(0, 1, 0, 100, 10);
+    int8_t e = add(1, 0, 1U << 3, 300, 0);     // events and a period
+    sim_irq(tick + 250, 1000, (1U << 3) | (1U << 7));
+
+    sim_run(1000);
+    SCHED_GetStats(p, &st);
+    CHECK(st.runs == 10, "periodic task ran %u times in 1 s, expected 10", st.runs);
+    CHECK(st.max_latency_ms == 0 && st.skipped == 0 && st.misses == 0,
+          "idle loop: latency %u, skipped %u, misses %u",
+          st.max_latency_ms, st.skipped, st.misses);
+
+    // Releases at 250 (event) then 300, 600, 900 (period)
+    SCHED_GetStats(e, &st);
+    CHECK(st.runs == 4, "event task ran %u times, expected 4", st.runs);
+    CHECK(last_events[1] == 0, "a periodic release passed events 0x%X", last_events[1]);
+    sim_run(250);
+    CHECK(last_events[1] == (1U << 3), "got events 0x%X, expected only its own 0x8",
+          last_events[1]);
+    printf("periodic: OK\n");
+}
+
+static void test_skip(void)
+{
+    SCHED_Stats st;
+
+    setup();
+    int8_t p = add(0, 2, 0, 10, 0);
+    add(1, 1, 1U << 0, 0, 0);
+    spend_ms[1] = 35;
+    sim_irq(tick + 5, 1000, 1U << 0);
+
+    // Releases at 10, 20, 30, 40 fall inside the long run (5..40)
+    sim_run(100);
+    SCHED_GetStats(p, &st);
+    CHECK(st.skipped == 3, "skipped %u periods, expected 3", st.skipped);
+    CHECK(st.runs == 7, "ran %u times in 100 ms, expected 7", st.runs);
+    CHECK(st.max_latency_ms == 0, "latency %u after the long run, expected 0 "
+          "(the release is the newest period)", st.max_latency_ms);
+    printf("skip: OK\n");
+}
+
+static void test_pending(void)
+{
+    setup();
+    add(0, 0, 1U << 2, 50, 0);
+
+    CHECK(!SCHED_Pending(), "pending with nothing released");
+    SCHED_Signal(1U << 5);
+    CHECK(!SCHED_Pending(), "pending on a bit no task has");
+    CHECK(!SCHED_RunOne(), "ran on a bit no task has");
+    SCHED_Signal(1U << 2);
+    CHECK(SCHED_Pending(), "not pending after a signal");
+    CHECK(SCHED_RunOne() && !SCHED_Pending(), "still pending after the run");
+    sim_spend(50);
+    CHECK(SCHED_Pending(), "not pending when the period came");
+    printf("pending: OK\n");
+}
+
+/* The main loop: readings every 500 ms (DMA IRQ), the display redrawn after
+ * each and on touch, USB, a health report every second.
+ */
+#define EV_BLOCK    (1U << 0)
+#define EV_DISPLAY  (1U << 1)
+#define EV_USB      (1U << 2)
+
+static void main_loop(uint32_t seconds, uint32_t lcd_ms, SCHED_Stats *reading,
+                      SCHED_Stats *display, uint8_t print)
+{
+    int8_t id[4];
+
+    setup();
+    id[0] = add(0, 1, EV_BLOCK, 0, 20);         // reading: glucose, trend, alarms
+    id[1] = add(1, 2, EV_USB, 0, 50);           // USB
+    id[2] = add(2, 3, EV_DISPLAY, 0, 1000);     // display
+    id[3] = add(3, 4, 0, 1000, 0);              // health report
+    spend_ms[0] = 3;
+    signal_after[0] = EV_DISPLAY | EV_USB;
+    spend_ms[1] = 1;
+    spend_ms[2] = lcd_ms;
+    spend_ms[3] = 2;
+    sim_irq(tick + 500, 500, EV_BLOCK);
+    sim_irq(tick + 137, 333, EV_DISPLAY);       // touch
+    sim_irq(tick + 50, 250, EV_USB);
+
+    sim_run(seconds * 1000U);
+    SCHED_GetStats(id[0], reading);
+    SCHED_GetStats(id[2], display);
+
+    if (print) {
+        printf("\nmain loop, %u s, display %u ms:\n", seconds, lcd_ms);
+        printf("  task       prio  runs  wcet cyc  latency  response  misses  skipped\n");
+        for (uint32_t i = 0; i < 4; i++) {
+            SCHED_Stats st;
+            const SCHED_Task *t = SCHED_GetTask(id[i]);
+            SCHED_GetStats(id[i], &st);
+            printf("  %-10s %4u %5u %9u %5u ms %6u ms %7u %8u\n",
+                   (const char *[]){ "reading", "usb", "display", "health" }[i],
+                   t->priority, st.runs, st.wcet_cycles, st.max_latency_ms,
+                   st.max_response_ms, st.misses, st.skipped);
+        }
+    }
+}
+
+static void test_main_loop(uint32_t seconds)
+{
+    SCHED_Stats reading, display;
+
+    // Display shorter than the reading deadline: never a miss
+    main_loop(seconds, 15, &reading, &display, 1);
+    CHECK(reading.runs == seconds * 2U, "%u readings in %u s", reading.runs, seconds);
+    CHECK(reading.misses == 0, "%u reading misses with a 15 ms display", reading.misses);
+    CHECK(reading.max_latency_ms <= 15, "reading waited %u ms, longer than one display run",
+          reading.max_latency_ms);
+    CHECK(display.wcet_cycles == 15U * CYCLES_PER_MS, "display wcet %u cycles",
+          display.wcet_cycles);
+
+    // Longer than the deadline: readings landing in a redraw miss it
+    main_loop(seconds, 40, &reading, &display, 1);
+    CHECK(reading.runs == seconds * 2U, "%u readings in %u s", reading.runs, seconds);
+    CHECK(reading.misses > 0, "no reading miss with a 40 ms display");
+    CHECK(reading.max_latency_ms <= 40, "reading waited %u ms, longer than one display run",
+          reading.max_latency_ms);
+    CHECK(reading.max_response_ms > 20, "response %u ms with misses counted",
+          reading.max_response_ms);
+    CHECK(display.wcet_cycles == 40U * CYCLES_PER_MS, "display wcet %u cycles",
+          display.wcet_cycles);
+}
+
+int main(int argc, char **argv)
+{
+    uint32_t seconds = (argc > 1) ? (uint32_t)strtoul(argv[1], NULL, 0) : 600U;
+
+    test_order();
+    test_periodic();
+    test_skip();
+    test_pending();
+    test_main_loop(seconds);
+
+    printf(failures ? "\nFAILED\n" : "\nOK\n");
+    return failures ? 1 : 0;
+}
@@ -0,0 +1,42 @@
+/*
+ * stm32l4xx_hal.h
+ *
+ *  Created on: Oct 17, 2026
+ *      Author: kings
+ *
+ *  Host stand-in for the HAL header: just what the scheduler uses. The
+ *  tick and the cycle counter are the simulated clock in sched_sim.c.
+ */
+
+#ifndef SIM_STM32L4XX_HAL_H_
+#define SIM_STM32L4XX_HAL_H_
+
+#include <stdint.h>
+#include <stddef.h>
+
+typedef struct {
+    volatile uint32_t DEMCR;
+} SIM_CoreDebug_Type;
+
+typedef struct {
+    volatile uint32_t CTRL;
+    volatile uint32_t CYCCNT;
+} SIM_DWT_Type;
+
+extern SIM_CoreDebug_Type SIM_CoreDebug;
+extern SIM_DWT_Type       SIM_DWT;
+
+#define CoreDebug                   (&SIM_CoreDebug)
+#define DWT                         (&SIM_DWT)
+#define CoreDebug_DEMCR_TRCENA_Msk  (1UL << 24)
+#define DWT_CTRL_CYCCNTENA_Msk      (1UL << 0)
+
+/* PRIMASK: simulated interrupts wait while it is set */
+void     __disable_irq(void);
+void     __enable_irq(void);
+uint32_t __get_PRIMASK(void);
+void     __set_PRIMASK(uint32_t primask);
+
+uint32_t HAL_GetTick(void);
+
+#endif /* SIM_STM32L4XX_HAL_H_ */
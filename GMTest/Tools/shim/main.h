@@ -0,0 +1,29 @@
+/*
+ * main.h
+ *
+ *  Created on: Oct 17, 2026
+ *      Author: kings
+ *
+ *  Host stand-in for main.h, shared by the Tools/ programs that build a
+ *  Core module on its own. Only what those modules take from it.
+ */
+
+#ifndef SIM_MAIN_H_
+#define SIM_MAIN_H_
+
+#include <stdint.h>
+
+// sample_ring.c: a full fence between the producer and consumer threads
+#define __DMB()     __atomic_thread_fence(__ATOMIC_SEQ_CST)
+
+// glucose_cal.c, filter.c: the DWT cycle counter they time themselves
+// with. Nothing advances it; the program using it defines SIM_DWT.
+typedef struct {
+    volatile uint32_t CYCCNT;
+} SIM_DWT_Type;
+
+extern SIM_DWT_Type SIM_DWT;
+
+#define DWT         (&SIM_DWT)
+
+#endif /* SIM_MAIN_H_ */
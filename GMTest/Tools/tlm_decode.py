@@ -0,0 +1,290 @@
+#!/usr/bin/env python3
+"""
+tlm_decode.py - decode the binary telemetry stream from the USB CDC port.
+
+Frames are COBS encoded and end in a zero byte; inside is the payload and
+its CRC-32 (little endian). See Core/Inc/telemetry.h for the payloads.
+
+    python3 Tools/tlm_decode.py /dev/ttyACM0            # readings, alarms
+    python3 Tools/tlm_decode.py /dev/ttyACM0 --rate     # throughput, 1/s
+    python3 Tools/tlm_decode.py capture.bin --samples raw.csv
+    python3 Tools/tlm_decode.py /dev/ttyACM0 --dump session.bin
+    python3 Tools/tlm_decode.py --selftest              # codec check
+
+A serial port needs pyserial; anything else is read as a file ('-' for
+stdin). --rate prints bytes, frames and samples per second and counts
+CRC errors and frames lost on the device (gaps in the sequence number),
+which makes it the throughput test for the link as well.
+
+--dump sends the "dump" command and saves the session log the device
+streams back (checked against the CRC in its end frame), then reports the
+transfer rate. Tools/flog_read.py lists the entries in it.
+"""
+
+import argparse
+import binascii
+import random
+import struct
+import sys
+import time
+
+TYPE_SAMPLES = 0x01
+TYPE_GLUCOSE = 0x02
+TYPE_ALARM = 0x03
+TYPE_EXPORT = 0x10
+TYPE_EXPORT_END = 0x11
+EXPORT_DATA = 0x100     # raw export bytes, not a frame type on the wire
+
+ALARM_KINDS = ["low", "high", "rapid"]
+ALARM_STATES = ["cleared", "pending", "ACTIVE", "silenced"]
+
+
+def cobs_encode(data):
+    out = bytearray()
+    block = bytearray()
+    for b in data:
+        if b == 0:
+            out.append(len(block) + 1)
+            out += block
+            block = bytearray()
+        else:
+            block.append(b)
+            if len(block) == 254:
+                out.append(255)
+                out += block
+                block = bytearray()
+    out.append(len(block) + 1)
+    out += block
+    return bytes(out)
+
+
+def cobs_decode(data):
+    out = bytearray()
+    i = 0
+    while i < len(data):
+        code = data[i]
+        if code == 0 or i + code > len(data):
+            raise ValueError("bad COBS block")
+        out += data[i + 1:i + code]
+        i += code
+        if code != 255 and i < len(data):
+            out.append(0)
+    return bytes(out)
+
+
+def make_frame(payload):
+    body = payload + struct.pack("<I", binascii.crc32(payload) & 0xFFFFFFFF)
+    return cobs_encode(body) + b"\x00"
+
+
+class Decoder:
+    """Feed raw bytes in, get (type, seq, fields) tuples out."""
+
+    def __init__(self):
+        self.buf = bytearray()
+        self.next_seq = None
+        self.frames = 0
+        self.crc_errors = 0
+        self.lost = 0
+        self.samples = 0
+        self.raw_left = 0
+        self.export_crc = 0
+
+    def feed(self, data):
+        self.buf += data
+        while True:
+            if self.raw_left:
+                if not self.buf:
+                    return
+                raw = bytes(self.buf[:self.raw_left])
+                del self.buf[:len(raw)]
+                self.raw_left -= len(raw)
+                self.export_crc = binascii.crc32(raw, self.export_crc)
+                yield EXPORT_DATA, None, raw
+                continue
+            end = self.buf.find(b"\x00")
+            if end < 0:
+                return
+            raw = bytes(self.buf[:end])
+            del self.buf[:end + 1]
+            if not raw:
+                continue
+            rec = self._frame(raw)
+            if rec is not None:
+                yield rec
+
+    def _frame(self, raw):
+        try:
+            body = cobs_decode(raw)
+        except ValueError:
+            self.crc_errors += 1
+            return None
+        if len(body) < 6:
+            self.crc_errors += 1
+            return None
+        payload, crc = body[:-4], struct.unpack("<I", body[-4:])[0]
+        if binascii.crc32(payload) & 0xFFFFFFFF != crc:
+            self.crc_errors += 1
+            return None
+
+        kind, seq = payload[0], payload[1]
+        if self.next_seq is not None:
+            self.lost += (seq - self.next_seq) & 0xFF
+        self.next_seq = (seq + 1) & 0xFF
+        self.frames += 1
+
+        if kind == TYPE_SAMPLES:
+            count, flags, tick0, span = struct.unpack_from("<BBIH", payload, 2)
+            raw16 = struct.unpack_from("<%dH" % count, payload, 10)
+            step = span / (count - 1) if count > 1 else 0.0
+            self.samples += count
+            return kind, seq, [(tick0 + i * step, v, flags)
+                               for i, v in enumerate(raw16)]
+        if kind == TYPE_GLUCOSE:
+            tick, glucose, filt, slope, valid, flags = \
+                struct.unpack_from("<IiHiBH", payload, 2)
+            return kind, seq, (tick, glucose / 65536.0, filt,
+                               slope / 65536.0 if valid else None, flags)
+        if kind == TYPE_ALARM:
+            tick, alarm, state = struct.unpack_from("<IBB", payload, 2)
+            return kind, seq, (tick, alarm, state)
+        if kind == TYPE_EXPORT:
+            self.raw_left = struct.unpack_from("<I", payload, 2)[0]
+            self.export_crc = 0
+            return kind, seq, self.raw_left
+        if kind == TYPE_EXPORT_END:
+            length, crc = struct.unpack_from("<II", payload, 2)
+            return kind, seq, (length, crc == self.export_crc & 0xFFFFFFFF)
+        return kind, seq, payload[2:]
+
+
+def open_input(path):
+    if path == "-":
+        return sys.stdin.buffer
+    if path.startswith("/dev/") or path.upper().startswith("COM"):
+        import serial  # pyserial
+        return serial.Serial(path, timeout=0.1)
+    return open(path, "rb")
+
+
+def run(args):
+    src = open_input(args.input)
+    live = args.input.startswith("/dev/") or args.input.upper().startswith("COM")
+    read = src.read1 if hasattr(src, "read1") else src.read
+    dump = open(args.dump, "wb") if args.dump else None
+    if dump and live:
+        src.reset_input_buffer()
+        src.write(b"dump\n")
+    dec = Decoder()
+    csv = open(args.samples, "w") if args.samples else None
+    if csv:
+        csv.write("tick_ms,raw16,flags\n")
+
+    t0 = time.monotonic()
+    last = (t0, 0, 0, 0)
+    nbytes = 0
+    t_dump = t0
+    while True:
+        data = read(4096)
+        if not data and not live:
+            break
+        nbytes += len(data)
+        for kind, seq, rec in dec.feed(data):
+            if kind == TYPE_SAMPLES:
+                if csv:
+                    for tick, v, flags in rec:
+                        csv.write("%.3f,%d,%d\n" % (tick, v, flags))
+            elif kind == TYPE_GLUCOSE and not args.rate:
+                tick, glucose, filt, slope, flags = rec
+                trend = "%+.1f mg/dL/min" % slope if slope is not None else "-"
+                print("%10d ms  glucose %6.1f mg/dL  filtered %5d  trend %s%s"
+                      % (tick, glucose, filt, trend,
+                         "  flags 0x%x" % flags if flags else ""))
+            elif kind == TYPE_EXPORT:
+                t_dump = time.monotonic()
+                print("export: %d bytes" % rec, file=sys.stderr)
+            elif kind == EXPORT_DATA and dump:
+                dump.write(rec)
+            elif kind == TYPE_EXPORT_END:
+                secs = max(time.monotonic() - t_dump, 1e-6)
+                print("export end: %d bytes, CRC %s, %.0f kB/s"
+                      % (rec[0], "ok" if rec[1] else "BAD", rec[0] / secs / 1e3),
+                      file=sys.stderr)
+                if dump:
+                    dump.close()
+                    return 0 if rec[1] else 1
+            elif kind == TYPE_ALARM and not args.rate:
+                tick, alarm, state = rec
+                name = ALARM_KINDS[alarm] if alarm < len(ALARM_KINDS) else alarm
+                st = ALARM_STATES[state] if state < len(ALARM_STATES) else state
+                print("%10d ms  alarm %s: %s" % (tick, name, st))
+
+        now = time.monotonic()
+        if args.rate and now - last[0] >= 1.0:
+            dt = now - last[0]
+            print("%8.0f B/s  %6.0f frames/s  %7.0f samples/s  "
+                  "crc errors %d  lost %d"
+                  % ((nbytes - last[1]) / dt, (dec.frames - last[2]) / dt,
+                     (dec.samples - last[3]) / dt, dec.crc_errors, dec.lost))
+            last = (now, nbytes, dec.frames, dec.samples)
+
+    print("%d bytes, %d frames, %d samples, %d crc errors, %d frames lost"
+          % (nbytes, dec.frames, dec.samples, dec.crc_errors, dec.lost),
+          file=sys.stderr)
+    return 1 if dump else 0
+
+
+def selftest():
+    """Round-trip a synthetic stream with some corruption, then time it."""
+    rnd = random.Random(1)
+    stream = bytearray()
+    sent = 0
+    for seq in range(2000):
+        count = 120
+        raw = [rnd.choice([0, 0x100, rnd.randrange(65536)]) for _ in range(count)]
+        payload = struct.pack("<BBBBIH", TYPE_SAMPLES, seq & 0xFF, count, 0,
+                              seq * 120, count - 1)
+        payload += struct.pack("<%dH" % count, *raw)
+        frame = make_frame(payload)
+        if seq % 500 == 7:
+            frame = frame[:10] + bytes([frame[10] ^ 0x55]) + frame[11:]
+        stream += frame
+        sent += 1
+
+    dec = Decoder()
+    start = time.perf_counter()
+    recs = []
+    for i in range(0, len(stream), 64):         # USB packet sized reads
+        recs += list(dec.feed(bytes(stream[i:i + 64])))
+    secs = time.perf_counter() - start
+
+    assert dec.crc_errors == 4, dec.crc_errors
+    assert dec.frames == sent - 4
+    assert dec.lost == 4, dec.lost
+    assert all(len(r[2]) == 120 for r in recs)
+    print("selftest ok: %d frames, %.1f%% framing overhead, decode %.2f MB/s"
+          % (dec.frames, 100.0 * (len(stream) / (sent * 240.0) - 1.0),
+             len(stream) / secs / 1e6))
+
+
+def main():
+    ap = argparse.ArgumentParser(description=__doc__.split("\n")[1])
+    ap.add_argument("input", nargs="?", help="serial port, file or -")
+    ap.add_argument("--samples", help="write raw samples to this CSV file")
+    ap.add_argument("--rate", action="store_true",
+                    help="print throughput once a second instead of readings")
+    ap.add_argument("--dump", help="fetch the session log into this file")
+    ap.add_argument("--selftest", action="store_true",
+                    help="check the codec and time the decoder")
+    args = ap.parse_args()
+
+    if args.selftest:
+        selftest()
+    elif args.input:
+        sys.exit(run(args))
+    else:
+        ap.error("no input")
+
+
+if __name__ == "__main__":
+    main()
@@ -50,7 +50,7 @@
   */
 /* Define size for the receive and transmit buffer over CDC */
 #define APP_RX_DATA_SIZE  2048
-#define APP_TX_DATA_SIZE  2048
+#define APP_TX_DATA_SIZE  4096
 /* USER CODE BEGIN EXPORTED_DEFINES */
 
 /* USER CODE END EXPORTED_DEFINES */
@@ -94,6 +94,8 @@
 extern USBD_CDC_ItfTypeDef USBD_Interface_fops_FS;
 
 /* USER CODE BEGIN EXPORTED_VARIABLES */
+// Split in two by telemetry.c for double-buffered transmit
+extern uint8_t UserTxBufferFS[APP_TX_DATA_SIZE];
 
 /* USER CODE END EXPORTED_VARIABLES */
 